@@ -527,6 +527,24 @@ def generateConfigs( gennPath ):
                     cout << "MPI finalized." << endl;
                 #endif
             }
+
+            std::string build_model_runner_pygenn( NNmodel & model, const std::string &path, int localHostID ) {
+
+                if (!model.isFinalized()) {
+                gennError("Model was not finalized in modelDefinition(). Please call model.finalize().");
+                }
+
+                #ifndef CPU_ONLY
+                    chooseDevice(model, path, localHostID);
+                #endif // CPU_ONLY
+                    const std::string libraryPath = build_model_runner(model, path, localHostID);
+
+                #ifdef MPI_ENABLE
+                    MPI_Finalize();
+                    cout << "MPI finalized." << endl;
+                #endif
+                return libraryPath;
+            }
             ''' )
 
         # generate SWIG interface files for models and InitVarSnippet
@@ -3,11 +3,13 @@
 # display genn-buildmodel.sh help
 genn_help () {
     echo "genn-buildmodel.sh script usage:"
-    echo "genn-buildmodel.sh [cdho] model"
+    echo "genn-buildmodel.sh [cdmvnlho] model"
     echo "-c            only generate simulation code for the CPU"
     echo "-d            enables the debugging mode"
     echo "-m            generate MPI simulation code"
     echo "-v            generates coverage information"
+    echo "-n            tune generated CPU code for the host processor"
+    echo "-l            enable link-time optimisation of generated CPU code"
     echo "-h            shows this help message"
     echo "-o outpath    changes the output directory"
     echo "-i includepath    add additional include directories (seperated by colons)"
@@ -24,12 +26,14 @@ trap 'genn_error $LINENO 50 "command failure"' ERR
 OUT_PATH="$PWD";
 BUILD_MODEL_INCLUDE=""
 while [[ -n "${!OPTIND}" ]]; do
-    while getopts "cdmvo:i:h" option; do
+    while getopts "cdmvnlo:i:h" option; do
     case $option in
         c) CPU_ONLY=1;;
         d) DEBUG=1;;
         m) MPI_ENABLE=1;;
         v) COVERAGE=1;;
+        n) NATIVE=1;;
+        l) LTO=1;;
         h) genn_help; exit;;
         o) OUT_PATH="$OPTARG";;
         i) BUILD_MODEL_INCLUDE="$OPTARG";;
@@ -86,6 +90,14 @@ if [[ -n "$COVERAGE" ]]; then
     GENERATEALL="$GENERATEALL"_COVERAGE
 fi
 
+if [[ -n "$NATIVE" ]]; then
+    MACROS="$MACROS NATIVE=1";
+fi
+
+if [[ -n "$LTO" ]]; then
+    MACROS="$MACROS LTO=1";
+fi
+
 # generate model code
 make -f "$GENN_PATH/lib/GNUmakefile" $MACROS
 
@@ -2,7 +2,9 @@
 
 // Standard includes
 #include <iomanip>
+#include <iterator>
 #include <limits>
+#include <set>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -124,9 +126,18 @@ const std::vector<FunctionTemplate> cpuFunctions = {
     {"gennrand_normal", 0, "standardNormalDistribution($(rng))", "standardNormalDistribution($(rng))"},
     {"gennrand_exponential", 0, "standardExponentialDistribution($(rng))", "standardExponentialDistribution($(rng))"},
     {"gennrand_log_normal", 2, "std::lognormal_distribution<double>($(0), $(1))($(rng))", "std::lognormal_distribution<float>($(0), $(1))($(rng))"},
-    {"gennrand_gamma", 1, "std::gamma_distribution<double>($(0), 1.0)($(rng))", "std::gamma_distribution<float>($(0), 1.0f)($(rng))"}
+    {"gennrand_gamma", 1, "std::gamma_distribution<double>($(0), 1.0)($(rng))", "std::gamma_distribution<float>($(0), 1.0f)($(rng))"},
+    {"gennrand_binomial", 2, "std::binomial_distribution<unsigned int>($(0), $(1))($(rng))", "std::binomial_distribution<unsigned int>($(0), $(1))($(rng))"}
 };
 
+//--------------------------------------------------------------------------
+//! \brief Is the type one of the saturating fixed-point types defined in fixedPoint.h
+//--------------------------------------------------------------------------
+inline bool isFixedPointType(const string &type)
+{
+    return (type.compare(0, 11, "FixedPoint<") == 0);
+}
+
 //--------------------------------------------------------------------------
 //! \brief Tool for substituting strings in the neuron code strings or other templates
 //--------------------------------------------------------------------------
@@ -142,6 +153,11 @@ bool regexVarSubstitute(string &s, const string &trg, const string &rep);
 //--------------------------------------------------------------------------
 bool regexFuncSubstitute(string &s, const string &trg, const string &rep);
 
+//--------------------------------------------------------------------------
+//! \brief Tool for scaling the timestep DT in code which is only evaluated every updateInterval timesteps
+//--------------------------------------------------------------------------
+void substituteUpdateIntervalDT(string &code, unsigned int updateInterval);
+
 //--------------------------------------------------------------------------
 //! \brief Does the code string contain any functions requiring random number generator
 //--------------------------------------------------------------------------
@@ -251,6 +267,69 @@ inline void value_substitutions(string &code, const vector<string> &names, const
     value_substitutions(code, names.cbegin(), names.cend(), values, ext);
 }
 
+//--------------------------------------------------------------------------
+//! \brief This function performs a list of substitutions for parameters in code snippets. Parameters flagged as
+//! dynamic are replaced with the name of the variable they are stored in and all others with their values.
+//--------------------------------------------------------------------------
+template<typename NameIter>
+inline void param_substitutions(string &code, NameIter namesBegin, NameIter namesEnd, const vector<double> &values,
+                                const vector<bool> &dynamic, const string &groupName, const string &ext = "")
+{
+    NameIter n = namesBegin;
+    for (size_t i = 0; n != namesEnd && i < values.size(); n++, i++) {
+        if (i < dynamic.size() && dynamic[i]) {
+            substitute(code, "$(" + *n + ext + ")", *n + groupName);
+        }
+        else {
+            substitute(code, "$(" + *n + ext + ")", "(" + writePreciseString(values[i]) + ")");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+//! \brief This function performs a list of substitutions for parameters in code snippets. Parameters flagged as
+//! dynamic are replaced with the name of the variable they are stored in and all others with their values.
+//--------------------------------------------------------------------------
+inline void param_substitutions(string &code, const vector<string> &names, const vector<double> &values,
+                                const vector<bool> &dynamic, const string &groupName, const string &ext = "")
+{
+    param_substitutions(code, names.cbegin(), names.cend(), values, dynamic, groupName, ext);
+}
+
+//--------------------------------------------------------------------------
+//! \brief This function adds the names and values of the variables used to store any parameters flagged as dynamic to a list
+//--------------------------------------------------------------------------
+template<typename NameIter>
+inline void addDynamicParamValues(vector<pair<string, double>> &dynamicParamValues, NameIter namesBegin, NameIter namesEnd,
+                                  const vector<double> &values, const vector<bool> &dynamic, const string &groupName)
+{
+    NameIter n = namesBegin;
+    for (size_t i = 0; n != namesEnd && i < values.size(); n++, i++) {
+        if (i < dynamic.size() && dynamic[i]) {
+            dynamicParamValues.emplace_back(*n + groupName, values[i]);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+//! \brief This function adds the names of any parameters flagged as dynamic to a list, along with the names
+//! of the derived parameters which depend on them
+//--------------------------------------------------------------------------
+template<typename DerivedNameIter>
+inline void addDynamicParamDependents(vector<pair<string, vector<string>>> &dynamicParamDependents, const vector<string> &paramNames,
+                                      DerivedNameIter derivedNamesBegin, const vector<bool> &dynamic, const vector<vector<size_t>> &dependencies)
+{
+    for (size_t i = 0; i < paramNames.size(); i++) {
+        if (i < dynamic.size() && dynamic[i]) {
+            vector<string> derivedNames;
+            for (size_t d : dependencies[i]) {
+                derivedNames.push_back(*std::next(derivedNamesBegin, d));
+            }
+            dynamicParamDependents.emplace_back(paramNames[i], derivedNames);
+        }
+    }
+}
+
 //--------------------------------------------------------------------------
 //! \brief This function performs a list of function substitutions in code snipped
 //--------------------------------------------------------------------------
@@ -270,6 +349,18 @@ string ensureFtype(const string &oldcode, const string &type);
 //--------------------------------------------------------------------------
 void checkUnreplacedVariables(const string &code, const string &codeName);
 
+//--------------------------------------------------------------------------
+/*! \brief This function hoists calls to maths functions whose arguments are invariant out of a block of code
+
+  Each call whose arguments consist only of literals, the given invariant identifiers (unless they are assigned
+  to within the code) and further maths functions is replaced by a constant. The declarations of these
+  constants are returned so they can be emitted before the block, for example outside the loop over neurons.
+ */
+//--------------------------------------------------------------------------
+string hoistInvariantExpressions(string &code,                                   //!< the code string to work on
+                                 const std::set<string> &invariantIdentifiers,   //!< identifiers whose values do not change within code
+                                 const string &prefix);                          //!< prefix for the names of the hoisted constants
+
 //--------------------------------------------------------------------------
 /*! \brief This function returns the 32-bit hash of a string - because these are used across MPI nodes which may have different libstdc++ it would be risky to use std::hash
  */
@@ -281,6 +372,7 @@ void preNeuronSubstitutionsInSynapticCode(
     string &wCode, //!< the code string to work on
     const SynapseGroup *sg,
     const string &offset,
+    const string &spikeTimeOffset,
     const string &axonalDelayOffset,
     const string &postIdx,
     const string &devPrefix,  //!< device prefix, "dd_" for GPU, nothing for CPU
@@ -291,6 +383,7 @@ void postNeuronSubstitutionsInSynapticCode(
     string &wCode, //!< the code string to work on
     const SynapseGroup *sg,
     const string &offset,
+    const string &spikeTimeOffset,
     const string &backPropDelayOffset,
     const string &preIdx,
     const string &devPrefix, //!< device prefix, "dd_" for GPU, nothing for CPU
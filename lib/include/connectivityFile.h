@@ -0,0 +1,226 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Standard C includes
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+// ConnectivityFile
+//----------------------------------------------------------------------------
+//! Single-file binary format for pre-generated sparse connectivity and weights
+/*! A file consists of a Header followed by:
+    - numPre + 1 64-bit row start indices
+    - numSynapses 32-bit postsynaptic indices, sorted within each row
+    - if FLAG_WEIGHTS is set, numSynapses weights of weightSize bytes (float or double)
+    - if FLAG_REVERSE is set, numPost + 1 64-bit column start indices followed by numSynapses
+      64-bit indices into the row-major arrays, ordered by postsynaptic neuron
+    The row-major sections can be read directly into YALE SparseProjections or padded into RAGGED ones.
+    All values are stored in the native byte order of the machine which wrote the file.
+    This header has no other GeNN dependencies so it can also be used by standalone tools */
+namespace ConnectivityFile
+{
+//! "GCON" in little-endian byte order
+const uint32_t magic = 0x4E4F4347;
+const uint32_t version = 1;
+
+enum Flags : uint32_t
+{
+    FLAG_WEIGHTS    = (1 << 0),
+    FLAG_REVERSE    = (1 << 1),
+};
+
+struct Header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t numPre;
+    uint32_t numPost;
+    uint64_t numSynapses;
+    uint32_t maxRowLength;
+    uint32_t maxColLength;
+    uint32_t flags;
+    uint32_t weightSize;
+};
+
+//! Writes connectivity in row-major form to \p filename
+/*! \p rowStart must have numPre + 1 entries and \p weights must either be empty or
+    have an entry for every synapse. If \p includeReverse is set, column-major
+    indices are calculated and written after the weights */
+template<typename WeightType>
+void write(const std::string &filename, unsigned int numPre, unsigned int numPost,
+           const std::vector<uint64_t> &rowStart, const std::vector<uint32_t> &ind,
+           const std::vector<WeightType> &weights, bool includeReverse)
+{
+    static_assert(sizeof(WeightType) == 4 || sizeof(WeightType) == 8, "Weights must be stored as float or double");
+
+    if(rowStart.size() != (numPre + 1) || rowStart.back() != ind.size()) {
+        throw std::runtime_error("Row starts do not match " + std::to_string(ind.size()) + " synapses in connectivity file '" + filename + "'");
+    }
+    if(!weights.empty() && weights.size() != ind.size()) {
+        throw std::runtime_error("Connectivity file '" + filename + "' must have a weight for every synapse");
+    }
+
+    // Count synapses in each column
+    std::vector<uint64_t> colStart(numPost + 1, 0);
+    for(uint32_t j : ind) {
+        colStart[j + 1]++;
+    }
+
+    Header header;
+    header.magic = magic;
+    header.version = version;
+    header.numPre = numPre;
+    header.numPost = numPost;
+    header.numSynapses = ind.size();
+    header.maxRowLength = 0;
+    for(unsigned int i = 0; i < numPre; i++) {
+        header.maxRowLength = std::max(header.maxRowLength, (uint32_t)(rowStart[i + 1] - rowStart[i]));
+    }
+    header.maxColLength = (uint32_t)*std::max_element(colStart.cbegin(), colStart.cend());
+    header.flags = (weights.empty() ? 0u : (uint32_t)FLAG_WEIGHTS) | (includeReverse ? (uint32_t)FLAG_REVERSE : 0u);
+    header.weightSize = weights.empty() ? 0 : sizeof(WeightType);
+
+    FILE *file = fopen(filename.c_str(), "wb");
+    if(file == NULL) {
+        throw std::runtime_error("Unable to open connectivity file '" + filename + "' for writing: " + strerror(errno));
+    }
+
+    bool success = (fwrite(&header, sizeof(Header), 1, file) == 1);
+    success = success && (fwrite(rowStart.data(), sizeof(uint64_t), rowStart.size(), file) == rowStart.size());
+    success = success && (fwrite(ind.data(), sizeof(uint32_t), ind.size(), file) == ind.size());
+    success = success && (fwrite(weights.data(), sizeof(WeightType), weights.size(), file) == weights.size());
+
+    if(includeReverse) {
+        // Convert column counts into start indices
+        for(unsigned int j = 0; j < numPost; j++) {
+            colStart[j + 1] += colStart[j];
+        }
+
+        // Scatter synapse indices into columns - as rows are visited in order, columns remain sorted by presynaptic index
+        std::vector<uint64_t> colSyn(ind.size());
+        std::vector<uint64_t> colPos(colStart.cbegin(), colStart.cend() - 1);
+        for(uint64_t s = 0; s < ind.size(); s++) {
+            colSyn[colPos[ind[s]]++] = s;
+        }
+
+        success = success && (fwrite(colStart.data(), sizeof(uint64_t), colStart.size(), file) == colStart.size());
+        success = success && (fwrite(colSyn.data(), sizeof(uint64_t), colSyn.size(), file) == colSyn.size());
+    }
+
+    if(fclose(file) != 0 || !success) {
+        throw std::runtime_error("Unable to write connectivity file '" + filename + "'");
+    }
+}
+
+//----------------------------------------------------------------------------
+// ConnectivityFile::Reader
+//----------------------------------------------------------------------------
+//! Reads the sections of a connectivity file in the order they are stored
+class Reader
+{
+public:
+    Reader(const std::string &filename) : m_Filename(filename)
+    {
+        m_File = fopen(filename.c_str(), "rb");
+        if(m_File == NULL) {
+            throw std::runtime_error("Unable to open connectivity file '" + filename + "': " + strerror(errno));
+        }
+
+        read(&m_Header, 1);
+        if(m_Header.magic != magic) {
+            throw std::runtime_error("'" + filename + "' is not a connectivity file");
+        }
+        if(m_Header.version != version) {
+            throw std::runtime_error("Connectivity file '" + filename + "' has unsupported version " + std::to_string(m_Header.version));
+        }
+        if((m_Header.flags & FLAG_WEIGHTS) && m_Header.weightSize != sizeof(float) && m_Header.weightSize != sizeof(double)) {
+            throw std::runtime_error("Connectivity file '" + filename + "' has unsupported weight size " + std::to_string(m_Header.weightSize));
+        }
+    }
+
+    ~Reader()
+    {
+        fclose(m_File);
+    }
+
+    Reader(const Reader&) = delete;
+    Reader &operator=(const Reader&) = delete;
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    const Header &getHeader() const{ return m_Header; }
+    bool hasWeights() const{ return (m_Header.flags & FLAG_WEIGHTS) != 0; }
+
+    //! Checks that the file describes a projection between populations of the given sizes
+    void checkDimensions(unsigned int numPre, unsigned int numPost, const std::string &synapseGroupName) const
+    {
+        if(m_Header.numPre != numPre || m_Header.numPost != numPost) {
+            throw std::runtime_error("Connectivity file '" + m_Filename + "' is " + std::to_string(m_Header.numPre) + "x" + std::to_string(m_Header.numPost)
+                      + " but synapse population '" + synapseGroupName + "' is " + std::to_string(numPre) + "x" + std::to_string(numPost));
+        }
+    }
+
+    //! Reads \p count elements of the current section into \p data
+    template<typename T>
+    void read(T *data, uint64_t count)
+    {
+        if(fread(data, sizeof(T), count, m_File) != count) {
+            throw std::runtime_error("Connectivity file '" + m_Filename + "' is truncated");
+        }
+    }
+
+    //! Reads \p count weights into \p data, converting them to its type
+    template<typename T>
+    void readWeights(T *data, uint64_t count)
+    {
+        // If weights are stored in the type being read, read them directly
+        if((std::is_same<T, float>::value && m_Header.weightSize == sizeof(float))
+            || (std::is_same<T, double>::value && m_Header.weightSize == sizeof(double)))
+        {
+            read(data, count);
+        }
+        else if(m_Header.weightSize == sizeof(float)) {
+            readConvert<float>(data, count);
+        }
+        else {
+            readConvert<double>(data, count);
+        }
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    template<typename FileType, typename T>
+    void readConvert(T *data, uint64_t count)
+    {
+        FileType buffer[4096];
+        while(count > 0) {
+            const uint64_t blockSize = std::min<uint64_t>(count, 4096);
+            read(buffer, blockSize);
+            for(uint64_t k = 0; k < blockSize; k++) {
+                data[k] = static_cast<T>(buffer[k]);
+            }
+            data += blockSize;
+            count -= blockSize;
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    const std::string m_Filename;
+    FILE *m_File;
+    Header m_Header;
+};
+}   // namespace ConnectivityFile
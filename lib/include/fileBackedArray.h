@@ -0,0 +1,86 @@
+#pragma once
+
+// Standard C++ includes
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+// POSIX includes
+#include <sys/mman.h>
+#include <unistd.h>
+
+// GeNN includes
+#include "utils.h"
+
+//----------------------------------------------------------------------------
+// FileBackedArray
+//----------------------------------------------------------------------------
+//! Helpers for storing large arrays in memory-mapped files so they can be paged in from disk rather than being held in RAM
+namespace FileBackedArray
+{
+//! Allocates an array of \p count elements backed by a temporary file in \p directory
+/*! The file is unlinked as soon as it is mapped so it is cleaned up when the mapping is freed
+    or the process exits. If \p directory is empty, the current working directory is used */
+template<typename T>
+T *allocate(const std::string &directory, const std::string &name, size_t count)
+{
+    if(count == 0) {
+        return nullptr;
+    }
+
+    // Create unique file
+    const std::string pathTemplate = (directory.empty() ? "." : directory) + "/" + name + "XXXXXX";
+    std::vector<char> path(pathTemplate.cbegin(), pathTemplate.cend());
+    path.push_back('\0');
+    const int fd = mkstemp(path.data());
+    if(fd == -1) {
+        gennError("Unable to create file '" + pathTemplate + "' for out-of-core array: " + strerror(errno));
+    }
+    unlink(path.data());
+
+    // Extend file to size of array and map it
+    const size_t size = count * sizeof(T);
+    if(ftruncate(fd, size) != 0) {
+        gennError("Unable to resize file for out-of-core array '" + name + "': " + strerror(errno));
+    }
+    void *array = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(array == MAP_FAILED) {
+        gennError("Unable to map file for out-of-core array '" + name + "': " + strerror(errno));
+    }
+    close(fd);
+
+    // Rows are visited in the order neurons spike so disable the kernel's sequential read-ahead
+    madvise(array, size, MADV_RANDOM);
+    return static_cast<T*>(array);
+}
+
+//! Frees an array allocated with allocate
+template<typename T>
+void free(T *array, size_t count)
+{
+    if(array != nullptr) {
+        munmap(array, count * sizeof(T));
+    }
+}
+
+//! Asks the kernel to start reading \p count elements of \p array, starting at \p start, from disk
+/*! This returns immediately so the range can be read while earlier rows are being processed */
+template<typename T>
+void prefetch(const T *array, size_t start, size_t count)
+{
+    if(count == 0) {
+        return;
+    }
+
+    // Round start of range down to a page boundary as required by madvise
+    static const uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+    const uintptr_t begin = (uintptr_t)(array + start);
+    const uintptr_t end = (uintptr_t)(array + start + count);
+    const uintptr_t pageBegin = begin & ~(pageSize - 1);
+    madvise((void*)pageBegin, end - pageBegin, MADV_WILLNEED);
+}
+}   // namespace FileBackedArray
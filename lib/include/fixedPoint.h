@@ -0,0 +1,201 @@
+#pragma once
+
+// Standard C++ includes
+#include <ostream>
+#include <type_traits>
+
+// Standard C includes
+#include <cmath>
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+// FixedPoint
+//----------------------------------------------------------------------------
+//! Signed 32-bit fixed-point number with F fractional bits and saturating arithmetic
+/*! This is used as the scalar type of models whose precision is set to one of the fixed-point FloatTypes.
+    Conversions from floating point round to nearest and all arithmetic saturates at the limits of the
+    representable range rather than wrapping. Products are truncated towards negative infinity (as
+    an arithmetic shift on a fixed-point DSP would) and quotients towards zero. Maths functions other
+    than the trivial ones are evaluated in double precision and converted back. */
+template<unsigned int F>
+class FixedPoint
+{
+    static_assert(F > 0 && F < 31, "FixedPoint requires between 1 and 30 fractional bits");
+
+public:
+    FixedPoint() = default;
+
+    template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    FixedPoint(T value) : m_Raw(fromInteger(value))
+    {
+    }
+
+    template<typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+    FixedPoint(T value) : m_Raw(fromFloating((double)value))
+    {
+    }
+
+    //------------------------------------------------------------------------
+    // Static API
+    //------------------------------------------------------------------------
+    //! Create fixed-point number directly from its underlying integer representation
+    static FixedPoint fromRaw(int32_t raw)
+    {
+        FixedPoint f;
+        f.m_Raw = raw;
+        return f;
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Get the underlying integer representation
+    int32_t getRaw() const{ return m_Raw; }
+
+    double toDouble() const{ return (double)m_Raw / (double)One; }
+
+    template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+    explicit operator T() const{ return static_cast<T>(toDouble()); }
+
+    //------------------------------------------------------------------------
+    // Operators
+    //------------------------------------------------------------------------
+    FixedPoint operator + () const{ return *this; }
+    FixedPoint operator - () const{ return fromRaw(saturate(-(int64_t)m_Raw)); }
+
+    FixedPoint &operator += (FixedPoint b){ m_Raw = saturate((int64_t)m_Raw + b.m_Raw); return *this; }
+    FixedPoint &operator -= (FixedPoint b){ m_Raw = saturate((int64_t)m_Raw - b.m_Raw); return *this; }
+    FixedPoint &operator *= (FixedPoint b){ m_Raw = multiply(m_Raw, b.m_Raw); return *this; }
+    FixedPoint &operator /= (FixedPoint b){ m_Raw = divide(m_Raw, b.m_Raw); return *this; }
+
+    friend FixedPoint operator + (FixedPoint a, FixedPoint b){ return a += b; }
+    friend FixedPoint operator - (FixedPoint a, FixedPoint b){ return a -= b; }
+    friend FixedPoint operator * (FixedPoint a, FixedPoint b){ return a *= b; }
+    friend FixedPoint operator / (FixedPoint a, FixedPoint b){ return a /= b; }
+
+    friend bool operator == (FixedPoint a, FixedPoint b){ return a.m_Raw == b.m_Raw; }
+    friend bool operator != (FixedPoint a, FixedPoint b){ return a.m_Raw != b.m_Raw; }
+    friend bool operator < (FixedPoint a, FixedPoint b){ return a.m_Raw < b.m_Raw; }
+    friend bool operator > (FixedPoint a, FixedPoint b){ return a.m_Raw > b.m_Raw; }
+    friend bool operator <= (FixedPoint a, FixedPoint b){ return a.m_Raw <= b.m_Raw; }
+    friend bool operator >= (FixedPoint a, FixedPoint b){ return a.m_Raw >= b.m_Raw; }
+
+    friend std::ostream &operator << (std::ostream &os, FixedPoint a){ return os << a.toDouble(); }
+
+    //------------------------------------------------------------------------
+    // Maths functions
+    //------------------------------------------------------------------------
+    // **NOTE** these are found by argument-dependent lookup so model code using
+    // the double precision maths functions works unchanged on fixed-point values
+    friend FixedPoint fabs(FixedPoint a){ return (a.m_Raw < 0) ? -a : a; }
+    friend FixedPoint abs(FixedPoint a){ return fabs(a); }
+    friend FixedPoint fmin(FixedPoint a, FixedPoint b){ return (b < a) ? b : a; }
+    friend FixedPoint fmax(FixedPoint a, FixedPoint b){ return (a < b) ? b : a; }
+    friend FixedPoint floor(FixedPoint a){ return fromRaw(a.m_Raw & ~(One - 1)); }
+    friend FixedPoint ceil(FixedPoint a){ return -floor(-a); }
+    friend FixedPoint trunc(FixedPoint a){ return (a.m_Raw < 0) ? ceil(a) : floor(a); }
+
+    friend FixedPoint round(FixedPoint a){ return std::round(a.toDouble()); }
+    friend FixedPoint sqrt(FixedPoint a){ return std::sqrt(a.toDouble()); }
+    friend FixedPoint cbrt(FixedPoint a){ return std::cbrt(a.toDouble()); }
+    friend FixedPoint exp(FixedPoint a){ return std::exp(a.toDouble()); }
+    friend FixedPoint exp2(FixedPoint a){ return std::exp2(a.toDouble()); }
+    friend FixedPoint expm1(FixedPoint a){ return std::expm1(a.toDouble()); }
+    friend FixedPoint log(FixedPoint a){ return std::log(a.toDouble()); }
+    friend FixedPoint log2(FixedPoint a){ return std::log2(a.toDouble()); }
+    friend FixedPoint log10(FixedPoint a){ return std::log10(a.toDouble()); }
+    friend FixedPoint log1p(FixedPoint a){ return std::log1p(a.toDouble()); }
+    friend FixedPoint sin(FixedPoint a){ return std::sin(a.toDouble()); }
+    friend FixedPoint cos(FixedPoint a){ return std::cos(a.toDouble()); }
+    friend FixedPoint tan(FixedPoint a){ return std::tan(a.toDouble()); }
+    friend FixedPoint asin(FixedPoint a){ return std::asin(a.toDouble()); }
+    friend FixedPoint acos(FixedPoint a){ return std::acos(a.toDouble()); }
+    friend FixedPoint atan(FixedPoint a){ return std::atan(a.toDouble()); }
+    friend FixedPoint sinh(FixedPoint a){ return std::sinh(a.toDouble()); }
+    friend FixedPoint cosh(FixedPoint a){ return std::cosh(a.toDouble()); }
+    friend FixedPoint tanh(FixedPoint a){ return std::tanh(a.toDouble()); }
+    friend FixedPoint erf(FixedPoint a){ return std::erf(a.toDouble()); }
+    friend FixedPoint erfc(FixedPoint a){ return std::erfc(a.toDouble()); }
+    friend FixedPoint pow(FixedPoint a, FixedPoint b){ return std::pow(a.toDouble(), b.toDouble()); }
+    friend FixedPoint atan2(FixedPoint a, FixedPoint b){ return std::atan2(a.toDouble(), b.toDouble()); }
+    friend FixedPoint hypot(FixedPoint a, FixedPoint b){ return std::hypot(a.toDouble(), b.toDouble()); }
+    friend FixedPoint fmod(FixedPoint a, FixedPoint b){ return std::fmod(a.toDouble(), b.toDouble()); }
+    friend FixedPoint copysign(FixedPoint a, FixedPoint b){ return ((a.m_Raw < 0) == (b.m_Raw < 0)) ? a : -a; }
+
+private:
+    //------------------------------------------------------------------------
+    // Constants
+    //------------------------------------------------------------------------
+    static const int32_t One = (int32_t)1 << F;
+
+    //------------------------------------------------------------------------
+    // Static helpers
+    //------------------------------------------------------------------------
+    static int32_t saturate(int64_t value)
+    {
+        if(value > INT32_MAX) {
+            return INT32_MAX;
+        }
+        else if(value < INT32_MIN) {
+            return INT32_MIN;
+        }
+        else {
+            return (int32_t)value;
+        }
+    }
+
+    template<typename T>
+    static int32_t fromInteger(T value)
+    {
+        // Clamp to the range of whole numbers which can be represented before scaling
+        const int64_t maxWhole = INT32_MAX >> F;
+        const int64_t minWhole = INT32_MIN >> F;
+        if(std::is_signed<T>::value ? ((int64_t)value > maxWhole) : ((uint64_t)value > (uint64_t)maxWhole)) {
+            return INT32_MAX;
+        }
+        else if(std::is_signed<T>::value && (int64_t)value < minWhole) {
+            return INT32_MIN;
+        }
+        else {
+            return saturate((int64_t)value * One);
+        }
+    }
+
+    static int32_t fromFloating(double value)
+    {
+        if(std::isnan(value)) {
+            return 0;
+        }
+        const double scaled = std::round(value * (double)One);
+        if(scaled >= (double)INT32_MAX) {
+            return INT32_MAX;
+        }
+        else if(scaled <= (double)INT32_MIN) {
+            return INT32_MIN;
+        }
+        else {
+            return (int32_t)scaled;
+        }
+    }
+
+    static int32_t multiply(int32_t a, int32_t b)
+    {
+        // **NOTE** right shift of a negative product is arithmetic on all supported compilers
+        return saturate(((int64_t)a * (int64_t)b) >> F);
+    }
+
+    static int32_t divide(int32_t a, int32_t b)
+    {
+        if(b == 0) {
+            return (a < 0) ? INT32_MIN : INT32_MAX;
+        }
+        else {
+            return saturate(((int64_t)a * One) / b);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    int32_t m_Raw;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+// Standard includes
+#include <functional>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------
+// FunctionTable
+//------------------------------------------------------------------------
+//! Lookup table used to replace calls to a function of a single argument in generated neuron code
+/*! The function is sampled at numIntervals + 1 evenly spaced points over [min, max) when the code is generated
+    and is evaluated by interpolating between these. Outside this range the original function is called. */
+class FunctionTable
+{
+public:
+    enum class Interpolation
+    {
+        LINEAR,     //!< Piecewise linear interpolation between neighbouring entries
+        CUBIC,      //!< Catmull-Rom cubic interpolation between the four surrounding entries
+    };
+
+    FunctionTable(const std::string &functionName, std::function<double(double)> function,
+                  double min, double max, unsigned int numIntervals, Interpolation interpolation);
+
+    //------------------------------------------------------------------------
+    // Public const methods
+    //------------------------------------------------------------------------
+    //! Gets the name of the function whose calls are replaced
+    const std::string &getFunctionName() const{ return m_FunctionName; }
+
+    double getMin() const{ return m_Min; }
+    double getMax() const{ return m_Max; }
+    unsigned int getNumIntervals() const{ return m_NumIntervals; }
+    Interpolation getInterpolation() const{ return m_Interpolation; }
+
+    //! Gets the name of the generated function which evaluates the table for the given neuron group
+    std::string getTableFunctionName(const std::string &groupName) const{ return m_FunctionName + "Table" + groupName; }
+
+    //! Is the function one of the standard maths functions rather than one provided in support code
+    bool isMathsFunction() const;
+
+    //! Gets the entries of the table
+    /*! Cubic tables have an additional entry before min and two after max so every interval has four neighbours */
+    std::vector<double> getEntries() const;
+
+    //! Evaluates the table at x (in double precision) using the given entries
+    double interpolate(const std::vector<double> &entries, double x) const;
+
+    //! Estimates the maximum absolute and relative errors of the table by evaluating it between the entries
+    std::pair<double, double> getMaxError() const;
+
+    //------------------------------------------------------------------------
+    // Static API
+    //------------------------------------------------------------------------
+    //! Gets the implementation of one of the standard maths functions of a single argument, or an empty function if there isn't one
+    static std::function<double(double)> getMathsFunction(const std::string &functionName);
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    std::string m_FunctionName;
+    std::function<double(double)> m_Function;
+    double m_Min;
+    double m_Max;
+    unsigned int m_NumIntervals;
+    Interpolation m_Interpolation;
+};
@@ -38,6 +38,18 @@ void generate_model_runner(const NNmodel &model,    //!< Model description
                            int localHostID);        //!< ID of local host
 
 
+//--------------------------------------------------------------------------
+/*! \brief This function generates the code for simulating a model, compiles it into a shared library and returns the path to the library.
+
+  The generated sources are compiled in parallel. The library is cached under a hash of the generated code, the GeNN headers and the compiler flags so that, if an unchanged model is generated again, the previously compiled library is returned without invoking the compiler.
+ */
+//--------------------------------------------------------------------------
+
+string build_model_runner(const NNmodel &model,     //!< Model description
+                          const string &path,       //!< Path where the generated code will be deposited
+                          int localHostID);         //!< ID of local host
+
+
 //--------------------------------------------------------------------------
 /*!
   \brief Helper function that prepares data structures and detects the hardware properties to enable the code generation code that follows.
@@ -45,6 +45,9 @@ namespace GENN_PREFERENCES {
     extern bool autoChooseDevice; //!< Flag to signal whether the GPU device should be chosen automatically
     extern bool optimizeCode; //!< Request speed-optimized code, at the expense of floating-point accuracy
     extern bool debugCode; //!< Request debug data to be embedded in the generated code
+    extern bool nativeCode; //!< Request CPU code tuned for the instruction set of the host processor (used for unix based platforms)
+    extern bool linkTimeOptimisation; //!< Request link-time optimisation of the CPU code (used for unix based platforms)
+    extern std::string profileGuidedOptimisation; //!< Profile-guided optimisation mode of the CPU code - "generate" to record a profile, "use" to build with it or empty to disable (used for unix based platforms)
     extern bool showPtxInfo; //!< Request that PTX assembler information be displayed for each CUDA kernel during compilation
     extern bool buildSharedLibrary; //!< Should generated code and Makefile build into a shared library e.g. for use in SpineML simulator
     extern bool autoInitSparseVars; //!< Previously, variables associated with sparse synapse populations were not automatically initialised. If this flag is set this now occurs in the initMODEL_NAME function and copyStateToDevice is deferred until here
@@ -64,6 +67,8 @@ namespace GENN_PREFERENCES {
     extern std::string userCxxFlagsWIN; //!< Allows users to set specific C++ compiler options they may want to use for all host side code (used for windows platforms)
     extern std::string userCxxFlagsGNU; //!< Allows users to set specific C++ compiler options they may want to use for all host side code (used for unix based platforms)
     extern std::string userNvccFlags; //!< Allows users to set specific nvcc compiler options they may want to use for all GPU code (identical for windows and unix platforms)
+    extern std::string buildCacheDirectory; //!< Directory in which build_model_runner caches compiled models - if empty, the directory containing the generated code is used
+    extern std::string outOfCoreDirectory; //!< Directory in which the files backing out-of-core synapse groups are created - if empty, the working directory of the simulation is used
 }
 
 extern unsigned int neuronBlkSz;            //!< Global variable containing the GPU block size for the neuron kernel
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 #define SET_ROW_BUILD_CODE(CODE) virtual std::string getRowBuildCode() const{ return CODE; }
 #define SET_ROW_BUILD_STATE_VARS(...) virtual NameTypeValVec getRowBuildStateVars() const{ return __VA_ARGS__; }
+#define SET_SHARED_ROW_BUILD_STATE_VARS(...) virtual NameTypeValVec getSharedRowBuildStateVars() const{ return __VA_ARGS__; }
 
 #define SET_CALC_MAX_ROW_LENGTH_FUNC(FUNC) virtual CalcMaxLengthFunc getCalcMaxRowLengthFunc() const{ return FUNC; }
 #define SET_CALC_MAX_COL_LENGTH_FUNC(FUNC) virtual CalcMaxLengthFunc getCalcMaxColLengthFunc() const{ return FUNC; }
@@ -29,6 +30,14 @@
 //! Base class for all sparse connectivity initialisation snippets
 namespace InitSparseConnectivitySnippet
 {
+//! Calculates the largest number of neurons in a target grid which lie within maxDistance of any one neuron in a source grid
+/*! Neurons are laid out in row-major order on grids of the given width and height (per layer) with the given spacing between
+    neighbouring neurons. Both grids start at the origin. This is used to calculate exact bounds on the row and column lengths
+    of spatial connectivity. */
+unsigned int calcMaxGridNeighbours(unsigned int numSrc, unsigned int srcWidth, unsigned int srcHeight, double srcSpacing,
+                                   unsigned int numTrg, unsigned int trgWidth, unsigned int trgHeight, double trgSpacing,
+                                   double maxDistance);
+
 class Base : public Snippet::Base
 {
 public:
@@ -43,6 +52,10 @@ public:
     virtual std::string getRowBuildCode() const{ return ""; }
     virtual NameTypeValVec getRowBuildStateVars() const{ return {}; }
 
+    //! Gets names, types and initial values of state variables which are initialised once and shared between all rows
+    /*! These rely on rows being built in order so are only supported when connectivity is initialised on the host */
+    virtual NameTypeValVec getSharedRowBuildStateVars() const{ return {}; }
+
     //! Get function to calculate the maximum row length of this connector based on the parameters and the size of the pre and postsynaptic population
     virtual CalcMaxLengthFunc getCalcMaxRowLengthFunc() const{ return CalcMaxLengthFunc(); }
 
@@ -202,4 +215,236 @@ public:
         "}\n");
 };
 
+//----------------------------------------------------------------------------
+// InitSparseConnectivitySnippet::FixedNumberPostWithReplacement
+//----------------------------------------------------------------------------
+//! Initialises connectivity with a fixed number of synapses per row
+//! whose postsynaptic targets are drawn uniformly, with replacement.
+/*! Rather than drawing the targets and then sorting them, the sorted
+    targets are drawn directly by sampling the order statistics of the
+    uniform distribution in turn - each position is a fraction of the
+    way from the previous one to the end of the row given by the smallest
+    of the remaining uniform samples (Bentley and Saxe, 1980). As
+    every row has the same length, no padding is required. */
+class FixedNumberPostWithReplacement : public Base
+{
+public:
+    DECLARE_SNIPPET(InitSparseConnectivitySnippet::FixedNumberPostWithReplacement, 1);
+
+    SET_ROW_BUILD_STATE_VARS({{"c", {"int", 0}}, {"x", {"scalar", 0.0}}});
+
+    SET_ROW_BUILD_CODE(
+        "if(c >= (int)$(rowLength)) {\n"
+        "   $(endRow);\n"
+        "}\n"
+        "const scalar u = $(gennrand_uniform);\n"
+        "x += (1.0 - x) * (1.0 - pow(u, 1.0 / (scalar)((int)$(rowLength) - c)));\n"
+        "unsigned int postIdx = (unsigned int)(x * $(num_post));\n"
+        "if(postIdx >= $(num_post)) {\n"
+        "   postIdx = $(num_post) - 1;\n"
+        "}\n"
+        "$(addSynapse, postIdx);\n"
+        "c++;\n");
+
+    SET_PARAM_NAMES({"rowLength"});
+
+    SET_CALC_MAX_ROW_LENGTH_FUNC(
+        [](unsigned int, unsigned int, const std::vector<double> &pars)
+        {
+            return (unsigned int)pars[0];
+        });
+    SET_CALC_MAX_COL_LENGTH_FUNC(
+        [](unsigned int numPre, unsigned int numPost, const std::vector<double> &pars)
+        {
+            // Calculate suitable quantile for 0.9999 change when drawing numPost times
+            const double quantile = pow(0.9999, 1.0 / (double)numPost);
+
+            return binomialInverseCDF(quantile, numPre * (unsigned int)pars[0], 1.0 / (double)numPost);
+        });
+};
+
+//----------------------------------------------------------------------------
+// InitSparseConnectivitySnippet::FixedNumberTotalWithReplacement
+//----------------------------------------------------------------------------
+//! Initialises connectivity with a fixed total number of synapses whose
+//! pre and postsynaptic neurons are drawn uniformly, with replacement.
+/*! The number of synapses in each row follows a multinomial distribution which
+    is sampled one row at a time - each row receives a binomially-distributed
+    share of the synapses not yet allocated to previous rows. The postsynaptic
+    targets within each row are then drawn in sorted order as in
+    FixedNumberPostWithReplacement. Because rows must be built in order,
+    this can only be used when connectivity is initialised on the host.
+
+    Because targets are drawn with replacement, a row or column can contain
+    duplicate synapses so the only exact bound on its length is total itself.
+    Allocating that for every row would make memory scale with numPre * total
+    so, like FixedProbability, the maximum row and column lengths are instead
+    binomial quantiles chosen so that the chance of any row or column
+    exceeding them is roughly 1 in 10000. */
+class FixedNumberTotalWithReplacement : public Base
+{
+public:
+    DECLARE_SNIPPET(InitSparseConnectivitySnippet::FixedNumberTotalWithReplacement, 1);
+
+    SET_SHARED_ROW_BUILD_STATE_VARS({{"allocated", {"unsigned int", 0}}});
+    SET_ROW_BUILD_STATE_VARS({{"rowLength", {"int", -1}}, {"c", {"int", 0}}, {"x", {"scalar", 0.0}}});
+
+    SET_ROW_BUILD_CODE(
+        "if(rowLength < 0) {\n"
+        "   const unsigned int remaining = (unsigned int)$(total) - allocated;\n"
+        "   rowLength = (int)$(gennrand_binomial, remaining, 1.0 / (double)($(num_pre) - $(id_pre)));\n"
+        "   allocated += rowLength;\n"
+        "}\n"
+        "if(c >= rowLength) {\n"
+        "   $(endRow);\n"
+        "}\n"
+        "const scalar u = $(gennrand_uniform);\n"
+        "x += (1.0 - x) * (1.0 - pow(u, 1.0 / (scalar)(rowLength - c)));\n"
+        "unsigned int postIdx = (unsigned int)(x * $(num_post));\n"
+        "if(postIdx >= $(num_post)) {\n"
+        "   postIdx = $(num_post) - 1;\n"
+        "}\n"
+        "$(addSynapse, postIdx);\n"
+        "c++;\n");
+
+    SET_PARAM_NAMES({"total"});
+
+    SET_CALC_MAX_ROW_LENGTH_FUNC(
+        [](unsigned int numPre, unsigned int, const std::vector<double> &pars)
+        {
+            // Calculate suitable quantile for 0.9999 change when drawing numPre times
+            const double quantile = pow(0.9999, 1.0 / (double)numPre);
+
+            return binomialInverseCDF(quantile, (unsigned int)pars[0], 1.0 / (double)numPre);
+        });
+    SET_CALC_MAX_COL_LENGTH_FUNC(
+        [](unsigned int, unsigned int numPost, const std::vector<double> &pars)
+        {
+            // Calculate suitable quantile for 0.9999 change when drawing numPost times
+            const double quantile = pow(0.9999, 1.0 / (double)numPost);
+
+            return binomialInverseCDF(quantile, (unsigned int)pars[0], 1.0 / (double)numPost);
+        });
+};
+
+//----------------------------------------------------------------------------
+// InitSparseConnectivitySnippet::SpatialGaussian2D
+//----------------------------------------------------------------------------
+//! Initialises distance-dependent connectivity between populations laid out on 2D grids
+/*! Pre and postsynaptic neurons are laid out in row-major order on grids starting at the origin
+    with preGridWidth and postGridWidth neurons per row, spaced preSpacing and postSpacing apart.
+    A synapse exists between a pair of neurons whose distance d is at most maxDistance with
+    probability prob * exp(-d^2 / (2 * sigma^2)). Rather than testing every postsynaptic neuron,
+    only those in the block of the postsynaptic grid surrounding each presynaptic neuron are
+    considered so the cost of initialisation scales with the number of candidate synapses.
+    The row and column lengths are bounded by the exact number of neurons within maxDistance. */
+class SpatialGaussian2D : public Base
+{
+public:
+    DECLARE_SNIPPET(InitSparseConnectivitySnippet::SpatialGaussian2D, 7);
+
+    SET_ROW_BUILD_CODE(
+        "const scalar preX = (scalar)($(id_pre) % (int)$(preGridWidth)) * $(preSpacing);\n"
+        "const scalar preY = (scalar)($(id_pre) / (int)$(preGridWidth)) * $(preSpacing);\n"
+        "const int postGridHeight = ($(num_post) + (int)$(postGridWidth) - 1) / (int)$(postGridWidth);\n"
+        "const int minX = (int)ceil((preX - $(maxDistance)) / $(postSpacing));\n"
+        "const int maxX = (int)floor((preX + $(maxDistance)) / $(postSpacing));\n"
+        "const int minY = (int)ceil((preY - $(maxDistance)) / $(postSpacing));\n"
+        "const int maxY = (int)floor((preY + $(maxDistance)) / $(postSpacing));\n"
+        "for(int y = (minY < 0) ? 0 : minY; (y <= maxY) && (y < postGridHeight); y++) {\n"
+        "   for(int x = (minX < 0) ? 0 : minX; (x <= maxX) && (x < (int)$(postGridWidth)); x++) {\n"
+        "       const int postIdx = (y * (int)$(postGridWidth)) + x;\n"
+        "       const scalar dX = ((scalar)x * $(postSpacing)) - preX;\n"
+        "       const scalar dY = ((scalar)y * $(postSpacing)) - preY;\n"
+        "       const scalar distSq = (dX * dX) + (dY * dY);\n"
+        "       if(postIdx < $(num_post) && distSq <= $(maxDistanceSq) && $(gennrand_uniform) < ($(prob) * exp(-distSq * $(invTwoSigmaSq)))) {\n"
+        "           $(addSynapse, postIdx);\n"
+        "       }\n"
+        "   }\n"
+        "}\n"
+        "$(endRow);\n");
+
+    SET_PARAM_NAMES({"prob", "sigma", "maxDistance", "preGridWidth", "preSpacing", "postGridWidth", "postSpacing"});
+    SET_DERIVED_PARAMS({
+        {"maxDistanceSq", [](const std::vector<double> &pars, double){ return pars[2] * pars[2]; }},
+        {"invTwoSigmaSq", [](const std::vector<double> &pars, double){ return 1.0 / (2.0 * pars[1] * pars[1]); }}});
+
+    SET_CALC_MAX_ROW_LENGTH_FUNC(
+        [](unsigned int numPre, unsigned int numPost, const std::vector<double> &pars)
+        {
+            const unsigned int preWidth = (unsigned int)pars[3];
+            const unsigned int postWidth = (unsigned int)pars[5];
+            return calcMaxGridNeighbours(numPre, preWidth, (numPre + preWidth - 1) / preWidth, pars[4],
+                                         numPost, postWidth, (numPost + postWidth - 1) / postWidth, pars[6], pars[2]);
+        });
+    SET_CALC_MAX_COL_LENGTH_FUNC(
+        [](unsigned int numPre, unsigned int numPost, const std::vector<double> &pars)
+        {
+            const unsigned int preWidth = (unsigned int)pars[3];
+            const unsigned int postWidth = (unsigned int)pars[5];
+            return calcMaxGridNeighbours(numPost, postWidth, (numPost + postWidth - 1) / postWidth, pars[6],
+                                         numPre, preWidth, (numPre + preWidth - 1) / preWidth, pars[4], pars[2]);
+        });
+};
+
+//----------------------------------------------------------------------------
+// InitSparseConnectivitySnippet::SpatialGaussian3D
+//----------------------------------------------------------------------------
+//! Initialises distance-dependent connectivity between populations laid out on 3D grids
+/*! As SpatialGaussian2D but neurons are laid out in layers of preGridWidth x preGridHeight
+    and postGridWidth x postGridHeight neurons. */
+class SpatialGaussian3D : public Base
+{
+public:
+    DECLARE_SNIPPET(InitSparseConnectivitySnippet::SpatialGaussian3D, 9);
+
+    SET_ROW_BUILD_CODE(
+        "const int preLayerSize = (int)$(preGridWidth) * (int)$(preGridHeight);\n"
+        "const scalar preX = (scalar)($(id_pre) % (int)$(preGridWidth)) * $(preSpacing);\n"
+        "const scalar preY = (scalar)(($(id_pre) % preLayerSize) / (int)$(preGridWidth)) * $(preSpacing);\n"
+        "const scalar preZ = (scalar)($(id_pre) / preLayerSize) * $(preSpacing);\n"
+        "const int postLayerSize = (int)$(postGridWidth) * (int)$(postGridHeight);\n"
+        "const int postGridDepth = ($(num_post) + postLayerSize - 1) / postLayerSize;\n"
+        "const int minX = (int)ceil((preX - $(maxDistance)) / $(postSpacing));\n"
+        "const int maxX = (int)floor((preX + $(maxDistance)) / $(postSpacing));\n"
+        "const int minY = (int)ceil((preY - $(maxDistance)) / $(postSpacing));\n"
+        "const int maxY = (int)floor((preY + $(maxDistance)) / $(postSpacing));\n"
+        "const int minZ = (int)ceil((preZ - $(maxDistance)) / $(postSpacing));\n"
+        "const int maxZ = (int)floor((preZ + $(maxDistance)) / $(postSpacing));\n"
+        "for(int z = (minZ < 0) ? 0 : minZ; (z <= maxZ) && (z < postGridDepth); z++) {\n"
+        "   for(int y = (minY < 0) ? 0 : minY; (y <= maxY) && (y < (int)$(postGridHeight)); y++) {\n"
+        "       for(int x = (minX < 0) ? 0 : minX; (x <= maxX) && (x < (int)$(postGridWidth)); x++) {\n"
+        "           const int postIdx = (z * postLayerSize) + (y * (int)$(postGridWidth)) + x;\n"
+        "           const scalar dX = ((scalar)x * $(postSpacing)) - preX;\n"
+        "           const scalar dY = ((scalar)y * $(postSpacing)) - preY;\n"
+        "           const scalar dZ = ((scalar)z * $(postSpacing)) - preZ;\n"
+        "           const scalar distSq = (dX * dX) + (dY * dY) + (dZ * dZ);\n"
+        "           if(postIdx < $(num_post) && distSq <= $(maxDistanceSq) && $(gennrand_uniform) < ($(prob) * exp(-distSq * $(invTwoSigmaSq)))) {\n"
+        "               $(addSynapse, postIdx);\n"
+        "           }\n"
+        "       }\n"
+        "   }\n"
+        "}\n"
+        "$(endRow);\n");
+
+    SET_PARAM_NAMES({"prob", "sigma", "maxDistance", "preGridWidth", "preGridHeight", "preSpacing",
+                     "postGridWidth", "postGridHeight", "postSpacing"});
+    SET_DERIVED_PARAMS({
+        {"maxDistanceSq", [](const std::vector<double> &pars, double){ return pars[2] * pars[2]; }},
+        {"invTwoSigmaSq", [](const std::vector<double> &pars, double){ return 1.0 / (2.0 * pars[1] * pars[1]); }}});
+
+    SET_CALC_MAX_ROW_LENGTH_FUNC(
+        [](unsigned int numPre, unsigned int numPost, const std::vector<double> &pars)
+        {
+            return calcMaxGridNeighbours(numPre, (unsigned int)pars[3], (unsigned int)pars[4], pars[5],
+                                         numPost, (unsigned int)pars[6], (unsigned int)pars[7], pars[8], pars[2]);
+        });
+    SET_CALC_MAX_COL_LENGTH_FUNC(
+        [](unsigned int numPre, unsigned int numPost, const std::vector<double> &pars)
+        {
+            return calcMaxGridNeighbours(numPost, (unsigned int)pars[6], (unsigned int)pars[7], pars[8],
+                                         numPre, (unsigned int)pars[3], (unsigned int)pars[4], pars[5], pars[2]);
+        });
+};
+
 }   // namespace InitVarSnippet
\ No newline at end of file
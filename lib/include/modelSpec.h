@@ -77,6 +77,7 @@ enum FloatType
     GENN_FLOAT,
     GENN_DOUBLE,
     GENN_LONG_DOUBLE,
+    GENN_FIXED_Q16_16,  //!< Saturating 32-bit fixed-point with 16 fractional bits - only supported in CPU_ONLY mode
 };
 
 //!< Precision to use for variables which store time
@@ -149,6 +150,7 @@ public:
     void setTimePrecision(TimePrecision timePrecision); //!< Set numerical precision for time
     void setDT(double); //!< Set the integration step size of the model
     void setTiming(bool); //!< Set whether timers and timing commands are to be included
+    void setPhaseOverlap(bool); //!< Set whether spike propagation through delayed synapse groups can overlap the neuron update in CPU simulations
     void setSeed(unsigned int); //!< Set the random seed (disables automatic seeding if argument not 0).
     void setRNType(const std::string &type); //! Sets the underlying type for random number generation (default: uint64_t)
 
@@ -158,6 +160,9 @@ public:
     //! Get the string literal that should be used to represent a value in the model's floating-point type
     string scalarExpr(const double) const;
 
+    //! Is the model's scalar type a fixed-point type rather than a floating-point one?
+    bool isFixedPointPrecision() const;
+
     void setPopulationSums(); //!< Set the accumulated sums of lowest multiple of kernel block size >= group sizes for all simulated groups.
     void finalize(); //!< Declare that the model specification is finalised in modelDefinition().
 
@@ -209,6 +214,23 @@ public:
     //! Are timers and timing commands enabled
     bool isTimingEnabled() const{ return timing; }
 
+    //! Is phase overlap enabled
+    bool isPhaseOverlapEnabled() const{ return phaseOverlap; }
+
+    //! Is spike propagation through this synapse group run on a worker thread concurrently with the neuron update?
+    /*! This is the case for synapse groups with axonal delays, no postsynaptic learning and no random number generation
+        if phase overlap is enabled, as the spikes they propagate were emitted before the current neuron update */
+    bool isSynapseGroupOverlapped(const SynapseGroup &sg) const;
+
+    //! Must this neuron group wait for overlapped synapse groups to complete before it is updated?
+    bool isNeuronGroupOverlapBlocked(const NeuronGroup &ng) const;
+
+    //! Are any synapse groups in this model overlapped with the neuron update?
+    bool isPhaseOverlapRequired() const;
+
+    //! Get the largest number of threads spikes are propagated through any synapse group on
+    unsigned int getMaxSpikePropagationThreads() const;
+
     //! Generate path for generated code
     std::string getGeneratedCodePath(const std::string &path, const std::string &filename) const;
 
@@ -391,7 +413,7 @@ public:
     /*! \tparam WeightUpdateModel type of weight update model (derived from WeightUpdateModels::Base).
         \tparam PostsynapticModel type of postsynaptic model (derived from PostsynapticModels::Base).
         \param name string containing unique name of neuron population.
-        \param mtype how the synaptic matrix associated with this synapse population should be represented.
+        \param mtype how the synaptic matrix associated with this synapse population should be represented (SynapseMatrixType::AUTO to choose automatically).
         \param delaySteps integer specifying number of timesteps delay this synaptic connection should incur (or NO_DELAY for none)
         \param src string specifying name of presynaptic (source) population
         \param trg string specifying name of postsynaptic (target) population
@@ -421,6 +443,12 @@ public:
         auto srcNeuronGrp = findNeuronGroup(src);
         auto trgNeuronGrp = findNeuronGroup(trg);
 
+        // If no matrix type is specified, choose one
+        if(mtype == SynapseMatrixType::AUTO) {
+            mtype = chooseSynapseMatrixType(name, wum, weightVarInitialisers.getInitialisers(), psm,
+                                            srcNeuronGrp, trgNeuronGrp, connectivityInitialiser);
+        }
+
 #ifdef MPI_ENABLE
         // Get host ID of target neuron group
         const int hostID = trgNeuronGrp->getClusterHostID();
@@ -610,6 +638,15 @@ public:
 
 
 private:
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+    //! Choose the synaptic matrix representation of a synapse group added with SynapseMatrixType::AUTO
+    /*! The choice and its estimated memory and traffic per presynaptic spike are reported on standard output */
+    SynapseMatrixType chooseSynapseMatrixType(const std::string &name, const WeightUpdateModels::Base *wum, const std::vector<NewModels::VarInit> &wuVarInitialisers,
+                                              const PostsynapticModels::Base *psm, const NeuronGroup *srcNeuronGroup, const NeuronGroup *trgNeuronGroup,
+                                              const InitSparseConnectivitySnippet::Init &connectivityInitialiser) const;
+
     //--------------------------------------------------------------------------
     // Private members
     //--------------------------------------------------------------------------
@@ -655,6 +692,7 @@ private:
     double dt;                      //!< The integration time step of the model
     bool final;                     //!< Flag for whether the model has been finalized
     bool timing;
+    bool phaseOverlap;              //!< Flag for whether spike propagation through delayed synapse groups can overlap the neuron update
     unsigned int seed;
     unsigned int resetKernel;       //!< The identity of the kernel in which the spike counters will be reset.
 };
@@ -7,6 +7,7 @@
 #include <vector>
 
 // GeNN includes
+#include "functionTable.h"
 #include "global.h"
 #include "newNeuronModels.h"
 #include "variableMode.h"
@@ -22,9 +23,9 @@ public:
     NeuronGroup(const std::string &name, int numNeurons, const NeuronModels::Base *neuronModel,
                 const std::vector<double> &params, const std::vector<NewModels::VarInit> &varInitialisers, int hostID, int deviceID) :
         m_Name(name), m_NumNeurons(numNeurons), m_IDRange(0, 0), m_PaddedIDRange(0, 0),
-        m_NeuronModel(neuronModel), m_Params(params), m_VarInitialisers(varInitialisers),
+        m_NeuronModel(neuronModel), m_Params(params), m_ParamDynamic(params.size(), false), m_VarInitialisers(varInitialisers),
         m_SpikeTimeRequired(false), m_TrueSpikeRequired(false), m_SpikeEventRequired(false),
-        m_NumDelaySlots(1), m_VarQueueRequired(varInitialisers.size(), false),
+        m_NumDelaySlots(1), m_UpdateInterval(1), m_ActiveSetUpdateEnabled(false), m_VersionedDelayQueuesEnabled(false), m_CompactSpikeTimesEnabled(false), m_VarQueueRequired(varInitialisers.size(), false),
         m_SpikeVarMode(GENN_PREFERENCES::defaultVarMode), m_SpikeEventVarMode(GENN_PREFERENCES::defaultVarMode),
         m_SpikeTimeVarMode(GENN_PREFERENCES::defaultVarMode), m_VarMode(varInitialisers.size(), GENN_PREFERENCES::defaultVarMode),
         m_HostID(hostID), m_DeviceID(deviceID)
@@ -93,6 +94,46 @@ public:
     /*! This is ignored for CPU simulations */
     void setVarMode(const std::string &varName, VarMode mode);
 
+    //! Enable skipping of neurons which are at rest and receiving no input
+    /*! Active neurons are tracked in a bitmask which synaptic input and current sources add neurons to and
+        which neurons leave when at rest. Requires the neuron model to provide a rest condition.
+        This is only used for CPU simulations */
+    void setActiveSetUpdateEnabled(bool enabled);
+
+    //! Only update this neuron group (along with its current sources and incoming postsynaptic models) every \p timesteps
+    /*! DT in their code and derived parameters is scaled accordingly and input accumulates in inSyn between updates.
+        This is only supported for CPU_ONLY simulations */
+    void setUpdateInterval(unsigned int timesteps);
+
+    //! Store spike times and delayed weight update model variables in versioned queues
+    /*! Rather than copying every neuron's values into the next delay slot each timestep, values are only written
+        when a neuron spikes, tagged with the timestep, and delayed reads search back for the most recent version.
+        Entries for neuron i are then found at versionHead[i] rather than the spike queue pointer.
+        This is only supported for CPU_ONLY simulations */
+    void setVersionedDelayQueuesEnabled(bool enabled){ m_VersionedDelayQueuesEnabled = enabled; }
+
+    //! Store spike times as the 32-bit integer timestep at which neurons spiked rather than as times
+    /*! They are converted back to times wherever they are read by model code. Spike times of neurons
+        which have not spiked are initialised to INT32_MIN rather than -TIME_MAX.
+        This is only supported for CPU_ONLY simulations */
+    void setCompactSpikeTimesEnabled(bool enabled){ m_CompactSpikeTimesEnabled = enabled; }
+
+    //! Store neuron model parameter in a variable which can be changed at runtime rather than embedding it in the generated code
+    /*! Derived parameters which depend on it will also be stored in variables. These are named by appending the
+        neuron group name to the parameter name, so that their values can be updated from the simulation code */
+    void setParamDynamic(const std::string &paramName, bool dynamic = true);
+
+    //! Replace calls to a standard maths function of one argument (e.g. exp or tanh) in this group's neuron code with a lookup table
+    /*! The function is sampled at \p numIntervals + 1 points over [\p min, \p max) and calls with arguments outside this range
+        are passed through to the original function. The estimated error of the table is reported when the code is generated */
+    void setFunctionTable(const std::string &functionName, double min, double max, unsigned int numIntervals,
+                          FunctionTable::Interpolation interpolation = FunctionTable::Interpolation::LINEAR);
+
+    //! Replace calls to a function of one argument defined in the neuron model's support code with a lookup table
+    /*! \p function should calculate the same thing as the support code function and is used to build the table */
+    void setFunctionTable(const std::string &functionName, std::function<double(double)> function, double min, double max,
+                          unsigned int numIntervals, FunctionTable::Interpolation interpolation = FunctionTable::Interpolation::LINEAR);
+
     void addSpkEventCondition(const std::string &code, const std::string &supportCodeNamespace);
 
     void addInSyn(SynapseGroup *synapseGroup){ m_InSyn.push_back(synapseGroup); }
@@ -124,6 +165,21 @@ public:
     const std::vector<double> &getDerivedParams() const{ return m_DerivedParams; }
     const std::vector<NewModels::VarInit> &getVarInitialisers() const{ return m_VarInitialisers; }
 
+    //! Which neuron model parameters are stored in variables which can be changed at runtime
+    const std::vector<bool> &getParamDynamic() const{ return m_ParamDynamic; }
+
+    //! Which derived parameters are stored in variables which can be changed at runtime
+    const std::vector<bool> &getDerivedParamDynamic() const{ return m_DerivedParamDynamic; }
+
+    //! Get names and initial values of variables used to store parameters which can be changed at runtime
+    std::vector<std::pair<std::string, double>> getDynamicParamValues() const;
+
+    //! Get names of parameters which can be changed at runtime along with the names of the derived parameters which depend on them
+    std::vector<std::pair<std::string, std::vector<std::string>>> getDynamicParamDependents() const;
+
+    //! Gets lookup tables used to replace function calls in this group's neuron code
+    const std::vector<FunctionTable> &getFunctionTables() const{ return m_FunctionTables; }
+
     //! Gets pointers to all synapse groups which provide input to this neuron group
     const std::vector<SynapseGroup*> &getInSyn() const{ return m_InSyn; }
     const std::vector<std::pair<SynapseGroup*, std::vector<SynapseGroup*>>> &getMergedInSyn() const{ return m_MergedInSyn; }
@@ -150,6 +206,27 @@ public:
     unsigned int getNumDelaySlots() const{ return m_NumDelaySlots; }
     bool isDelayRequired() const{ return (m_NumDelaySlots > 1); }
 
+    //! Are neurons which are at rest and receiving no input skipped?
+    bool isActiveSetUpdateEnabled() const{ return m_ActiveSetUpdateEnabled; }
+
+    //! Gets the number of timesteps between updates of this neuron group
+    unsigned int getUpdateInterval() const{ return m_UpdateInterval; }
+
+    //! Are versioned queues used for spike times and delayed weight update model variables if they are required?
+    bool isVersionedDelayQueuesEnabled() const{ return m_VersionedDelayQueuesEnabled; }
+
+    //! Do spike times or any weight update model variables, which are only updated when neurons spike, require delay queues?
+    bool isSpikeTriggeredVarQueueRequired() const;
+
+    //! Are spike times and delayed weight update model variables stored in versioned queues?
+    bool isVersionedDelayQueueRequired() const{ return isVersionedDelayQueuesEnabled() && isSpikeTriggeredVarQueueRequired(); }
+
+    //! Are spike times stored as integer timesteps?
+    bool isCompactSpikeTimesEnabled() const{ return m_CompactSpikeTimesEnabled; }
+
+    //! Get the type used to store spike times
+    std::string getSpikeTimeType(const std::string &timePrecision) const{ return isCompactSpikeTimesEnabled() ? "int32_t" : timePrecision; }
+
     bool isSpikeZeroCopyEnabled() const{ return (m_SpikeVarMode & VarLocation::ZERO_COPY); }
     bool isSpikeEventZeroCopyEnabled() const{ return (m_SpikeEventVarMode & VarLocation::ZERO_COPY); }
     bool isSpikeTimeZeroCopyEnabled() const{ return (m_SpikeTimeVarMode & VarLocation::ZERO_COPY); }
@@ -205,6 +282,12 @@ public:
     //! Get the expression to calculate the queue offset for accessing state of variables in previous timestep
     std::string getPrevQueueOffset(const std::string &devPrefix) const;
 
+    //! Get the expression to convert stored spike time \p value into a time
+    std::string getSpikeTimeValue(const std::string &value) const;
+
+    //! Get the expression to calculate the versioned queue offset for accessing the state of neuron \p idx's spike triggered variables \p delaySteps timesteps ago
+    std::string getVersionedQueueOffset(const std::string &idx, unsigned int delaySteps) const;
+
 private:
     //------------------------------------------------------------------------
     // Private methods
@@ -224,6 +307,17 @@ private:
     const NeuronModels::Base *m_NeuronModel;
     std::vector<double> m_Params;
     std::vector<double> m_DerivedParams;
+
+    //!< Which parameters and derived parameters are stored in variables rather than embedded in code
+    std::vector<bool> m_ParamDynamic;
+    std::vector<bool> m_DerivedParamDynamic;
+
+    //!< Indices of the derived parameters which depend on each parameter stored in a variable
+    std::vector<std::vector<size_t>> m_DerivedParamDependencies;
+
+    //!< Lookup tables used to replace function calls in neuron code
+    std::vector<FunctionTable> m_FunctionTables;
+
     std::vector<NewModels::VarInit> m_VarInitialisers;
     std::vector<SynapseGroup*> m_InSyn;
     std::vector<SynapseGroup*> m_OutSyn;
@@ -235,6 +329,18 @@ private:
     unsigned int m_NumDelaySlots;
     std::vector<CurrentSource*> m_CurrentSources;
 
+    //!< Number of timesteps between updates of this neuron group
+    unsigned int m_UpdateInterval;
+
+    //!< Whether neurons which are at rest and receiving no input are skipped
+    bool m_ActiveSetUpdateEnabled;
+
+    //!< Whether spike triggered variables are stored in versioned queues rather than copied between delay slots
+    bool m_VersionedDelayQueuesEnabled;
+
+    //!< Whether spike times are stored as integer timesteps
+    bool m_CompactSpikeTimesEnabled;
+
     //!< Vector specifying which variables require queues
     std::vector<bool> m_VarQueueRequired;
 
@@ -18,6 +18,7 @@
 #define SET_SIM_CODE(SIM_CODE) virtual std::string getSimCode() const{ return SIM_CODE; }
 #define SET_THRESHOLD_CONDITION_CODE(THRESHOLD_CONDITION_CODE) virtual std::string getThresholdConditionCode() const{ return THRESHOLD_CONDITION_CODE; }
 #define SET_RESET_CODE(RESET_CODE) virtual std::string getResetCode() const{ return RESET_CODE; }
+#define SET_REST_CONDITION_CODE(REST_CONDITION_CODE) virtual std::string getRestConditionCode() const{ return REST_CONDITION_CODE; }
 #define SET_SUPPORT_CODE(SUPPORT_CODE) virtual std::string getSupportCode() const{ return SUPPORT_CODE; }
 #define SET_EXTRA_GLOBAL_PARAMS(...) virtual StringPairVec getExtraGlobalParams() const{ return __VA_ARGS__; }
 #define SET_ADDITIONAL_INPUT_VARS(...) virtual NameTypeValVec getAdditionalInputVars() const{ return __VA_ARGS__; }
@@ -46,6 +47,12 @@ public:
     //! Gets code that defines the reset action taken after a spike occurred. This can be empty
     virtual std::string getResetCode() const{ return ""; }
 
+    //! Gets code which defines the condition under which the neuron is at rest.
+    /*! This evaluates to a bool (e.g. "$(V) == $(Vrest)") and should only be true if, in the absence of input,
+        the sim code would leave the neuron's state unchanged and it would not spike. Used to skip quiescent
+        neurons in groups with NeuronGroup::setActiveSetUpdateEnabled. This can be empty */
+    virtual std::string getRestConditionCode() const{ return ""; }
+
     //! Gets support code to be made available within the neuron kernel/funcion.
     /*! This is intended to contain user defined device functions that are used in the neuron codes.
         Preprocessor defines are also allowed if appropriately safeguarded against multiple definition by using ifndef;
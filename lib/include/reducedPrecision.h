@@ -0,0 +1,238 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+
+// Standard C includes
+#include <cstdint>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+// HalfFormat
+//----------------------------------------------------------------------------
+//! IEEE 754 binary16 - 5 exponent bits and 10 mantissa bits
+struct HalfFormat
+{
+    static uint16_t encode(float value)
+    {
+        uint32_t f;
+        std::memcpy(&f, &value, sizeof(float));
+
+        const uint16_t sign = (uint16_t)((f >> 16) & 0x8000);
+        f &= 0x7FFFFFFF;
+
+        // Infinity and NaN (keeping NaNs quiet)
+        if(f >= 0x7F800000) {
+            return sign | 0x7C00 | ((f > 0x7F800000) ? 0x200 : 0);
+        }
+        // Values which round to more than the largest half (65504) overflow to infinity
+        else if(f >= 0x477FF000) {
+            return sign | 0x7C00;
+        }
+        // Values below the smallest normal half (2^-14) become subnormal or zero
+        else if(f < 0x38800000) {
+            if(f < 0x33000000) {
+                return sign;
+            }
+
+            const uint32_t mantissa = (f & 0x7FFFFF) | 0x800000;
+            const uint32_t shift = 126 - (f >> 23);
+            return sign | roundShift(mantissa, shift);
+        }
+        // Otherwise, rebias exponent and round mantissa
+        // **NOTE** a mantissa carry correctly increments the exponent
+        else {
+            return sign | roundShift(f - (112 << 23), 13);
+        }
+    }
+
+    static float decode(uint16_t bits)
+    {
+        const uint32_t sign = (uint32_t)(bits & 0x8000) << 16;
+        const uint32_t exponent = (bits >> 10) & 0x1F;
+        const uint32_t mantissa = bits & 0x3FF;
+
+        // Zero and subnormals are exactly representable as scaled floats
+        if(exponent == 0) {
+            const float value = (float)mantissa * 5.9604644775390625e-8f;
+            return sign ? -value : value;
+        }
+
+        const uint32_t f = (exponent == 31)
+            ? (sign | 0x7F800000 | (mantissa << 13))
+            : (sign | ((exponent + 112) << 23) | (mantissa << 13));
+
+        float value;
+        std::memcpy(&value, &f, sizeof(float));
+        return value;
+    }
+
+private:
+    //! Shift value right, rounding to nearest even
+    static uint16_t roundShift(uint32_t value, uint32_t shift)
+    {
+        const uint32_t half = 1u << (shift - 1);
+        const uint32_t remainder = value & ((1u << shift) - 1);
+        uint32_t result = value >> shift;
+        if(remainder > half || (remainder == half && (result & 1))) {
+            result++;
+        }
+        return (uint16_t)result;
+    }
+};
+
+//----------------------------------------------------------------------------
+// BFloat16Format
+//----------------------------------------------------------------------------
+//! Brain floating point - the top 16 bits of an IEEE 754 single precision number
+struct BFloat16Format
+{
+    static uint16_t encode(float value)
+    {
+        uint32_t f;
+        std::memcpy(&f, &value, sizeof(float));
+
+        // Keep NaNs quiet rather than letting rounding turn them into infinities
+        if((f & 0x7FFFFFFF) > 0x7F800000) {
+            return (uint16_t)((f >> 16) | 0x40);
+        }
+        // Otherwise round to nearest even
+        else {
+            return (uint16_t)((f + 0x7FFF + ((f >> 16) & 1)) >> 16);
+        }
+    }
+
+    static float decode(uint16_t bits)
+    {
+        const uint32_t f = (uint32_t)bits << 16;
+
+        float value;
+        std::memcpy(&value, &f, sizeof(float));
+        return value;
+    }
+};
+
+//----------------------------------------------------------------------------
+// ReducedPrecision
+//----------------------------------------------------------------------------
+//! 16-bit storage for a floating point variable which is read and written as type T
+/*! This is used for weight update model state variables whose storage type is set with
+    SynapseGroup::setWUVarStorageType. Values are converted to T whenever they are read and
+    rounded to nearest even whenever they are written so model code can use them like any
+    other variable while arithmetic continues to be performed at the model's precision. */
+template<typename Format, typename T>
+class ReducedPrecision
+{
+public:
+    ReducedPrecision() = default;
+
+    template<typename V>
+    ReducedPrecision(V value) : m_Bits(Format::encode(static_cast<float>(value)))
+    {
+    }
+
+    //------------------------------------------------------------------------
+    // Static API
+    //------------------------------------------------------------------------
+    //! Create value directly from its 16-bit representation
+    static ReducedPrecision fromBits(uint16_t bits)
+    {
+        ReducedPrecision r;
+        r.m_Bits = bits;
+        return r;
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Get the underlying 16-bit representation
+    uint16_t getBits() const{ return m_Bits; }
+
+    operator T() const{ return static_cast<T>(Format::decode(m_Bits)); }
+
+    //------------------------------------------------------------------------
+    // Operators
+    //------------------------------------------------------------------------
+    template<typename V>
+    ReducedPrecision &operator += (V b){ return *this = static_cast<T>(*this) + b; }
+
+    template<typename V>
+    ReducedPrecision &operator -= (V b){ return *this = static_cast<T>(*this) - b; }
+
+    template<typename V>
+    ReducedPrecision &operator *= (V b){ return *this = static_cast<T>(*this) * b; }
+
+    template<typename V>
+    ReducedPrecision &operator /= (V b){ return *this = static_cast<T>(*this) / b; }
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    uint16_t m_Bits;
+};
+
+//----------------------------------------------------------------------------
+// Codebook
+//----------------------------------------------------------------------------
+//! 8-bit index into a table of \p Size values of type T
+/*! This is used for weight update model state variables given a codebook with
+    SynapseGroup::setWUVarCodebook. \p Values must be sorted in ascending order.
+    Reading a value is a single lookup into the (cache-resident) table, whereas writing
+    a value stores the index of the nearest entry, so variables stored in this way should
+    not be updated by model code. */
+template<typename T, const T *Values, unsigned int Size>
+class Codebook
+{
+    static_assert(Size > 0 && Size <= 256, "Codebooks must have between 1 and 256 entries");
+
+public:
+    Codebook() = default;
+
+    template<typename V>
+    Codebook(V value) : m_Index(findNearest(static_cast<T>(value)))
+    {
+    }
+
+    //------------------------------------------------------------------------
+    // Static API
+    //------------------------------------------------------------------------
+    //! Create value directly from its index into the codebook
+    static Codebook fromIndex(uint8_t index)
+    {
+        Codebook c;
+        c.m_Index = index;
+        return c;
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Get the index of this value in the codebook
+    uint8_t getIndex() const{ return m_Index; }
+
+    operator T() const{ return Values[m_Index]; }
+
+private:
+    //------------------------------------------------------------------------
+    // Private static methods
+    //------------------------------------------------------------------------
+    static uint8_t findNearest(T value)
+    {
+        const T *upper = std::lower_bound(Values, Values + Size, value);
+        if(upper == Values) {
+            return 0;
+        }
+        else if(upper == (Values + Size) || (value - *(upper - 1)) <= (*upper - value)) {
+            return (uint8_t)(upper - 1 - Values);
+        }
+        else {
+            return (uint8_t)(upper - Values);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    uint8_t m_Index;
+};
@@ -1,10 +1,15 @@
 #pragma once
 
 // Standard C++ includes
+#include <algorithm>
 #include <functional>
+#include <limits>
 #include <string>
 #include <vector>
 
+// Standard C includes
+#include <cassert>
+
 //----------------------------------------------------------------------------
 // Macros
 //----------------------------------------------------------------------------
@@ -127,6 +132,69 @@ public:
     //! Gets names of derived model parameters and the function objects to call to
     //! Calculate their value from a vector of model parameter values
     virtual DerivedParamVec getDerivedParams() const{ return {}; }
+
+    //------------------------------------------------------------------------
+    // Public methods
+    //------------------------------------------------------------------------
+    //! Find the index of a named parameter
+    size_t getParamIndex(const std::string &paramName) const
+    {
+        const auto paramNames = getParamNames();
+        auto paramIter = std::find(paramNames.begin(), paramNames.end(), paramName);
+        assert(paramIter != paramNames.end());
+
+        return distance(paramNames.begin(), paramIter);
+    }
+
+    //----------------------------------------------------------------------------
+    // Static API
+    //----------------------------------------------------------------------------
+    //! Determine which derived parameters depend on each of the parameters flagged as dynamic
+    /*! Derived parameters are calculated by arbitrary functions so this is found by replacing each dynamic
+        parameter in turn with a series of probe values and checking which derived parameters change. NaN
+        propagates through almost all arithmetic, while zero, values either side of the parameter's value and
+        very large magnitudes cross most thresholds used by functions with branches, min or max. The indices of
+        the derived parameters which depend on each parameter are returned (empty for constant parameters) */
+    static std::vector<std::vector<size_t>> getDerivedParamDependencies(const DerivedParamVec &derivedParams, const std::vector<double> &params,
+                                                                        const std::vector<bool> &dynamicParams, double dt)
+    {
+        std::vector<std::vector<size_t>> dependencies(params.size());
+        for(size_t p = 0; p < params.size(); p++) {
+            if(!dynamicParams[p]) {
+                continue;
+            }
+
+            const double value = params[p];
+            const double probes[] = {std::numeric_limits<double>::quiet_NaN(), 0.0, -value, (value * 1.5) + 1.0, (value * 0.5) - 1.0,
+                                     std::numeric_limits<double>::max() / 4.0, -std::numeric_limits<double>::max() / 4.0};
+            for(size_t d = 0; d < derivedParams.size(); d++) {
+                const double original = derivedParams[d].second(params, dt);
+                for(double probe : probes) {
+                    std::vector<double> probeParams = params;
+                    probeParams[p] = probe;
+
+                    // **NOTE** comparison is false if either value is NaN so they are treated as dependent
+                    if(!(derivedParams[d].second(probeParams, dt) == original)) {
+                        dependencies[p].push_back(d);
+                        break;
+                    }
+                }
+            }
+        }
+        return dependencies;
+    }
+
+    //! Determine which derived parameters depend on any of the parameters flagged as dynamic
+    static std::vector<bool> getDynamicDerivedParams(const std::vector<std::vector<size_t>> &dependencies, size_t numDerivedParams)
+    {
+        std::vector<bool> dynamicDerivedParams(numDerivedParams, false);
+        for(const auto &p : dependencies) {
+            for(size_t d : p) {
+                dynamicDerivedParams[d] = true;
+            }
+        }
+        return dynamicDerivedParams;
+    }
 };
 
 //----------------------------------------------------------------------------
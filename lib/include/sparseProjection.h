@@ -12,6 +12,9 @@
 --------------------------------------------------------------------------*/
 #pragma once
 
+// Standard C includes
+#include <cstdint>
+
 //! \brief class (struct) for defining a spars connectivity projection
 struct SparseProjection{
     unsigned int *indInG;
@@ -24,7 +27,9 @@ struct SparseProjection{
 };
 
 //! Row-major ordered sparse matrix structure in 'ragged' format
-template<typename PostIndexType>
+/*! SynIndexType is used for indices into the padded row-major matrix and is
+    64-bit if this has more than 2^32 entries (see SynapseGroup::getSynapseIndexType) */
+template<typename PostIndexType, typename SynIndexType = unsigned int>
 struct RaggedProjection {
     RaggedProjection(unsigned int maxRow, unsigned int maxCol) 
     : maxRowLength(maxRow), maxColLength(maxCol), synRemapSize(0)
@@ -44,11 +49,33 @@ struct RaggedProjection {
     unsigned int *colLength;
     
     //! Ragged column-major matrix, padded to maxColLength containing indices back into ind
-    unsigned int *remap;
+    SynIndexType *remap;
 
     //! Size of synRemap array (i.e. actual number of synapses)
-    unsigned int synRemapSize;
+    SynIndexType synRemapSize;
 
     //! Indices back into ind for each synapse
-    unsigned int *synRemap;
+    SynIndexType *synRemap;
+};
+
+//! Row-major sparse connectivity with postsynaptic indices delta-encoded into fixed-width bit fields
+/*! Built from the ind array of a RaggedProjection by createDeltaIndices. The first synapse of each row
+    is stored in rowBase and each synapse j in the row has a delta from the previous one (0 for j = 0)
+    stored in bits [j * rowWidth, (j + 1) * rowWidth) of the words beginning at rowStart. One word of
+    padding follows the last row so any delta can be extracted from a single 64-bit window */
+struct DeltaProjection {
+    //! Index of the first postsynaptic neuron in each row
+    unsigned int *rowBase;
+
+    //! Number of bits used to store each delta in each row (0 - 32)
+    uint8_t *rowWidth;
+
+    //! Index of the first word of each row's deltas in words
+    uint64_t *rowStart;
+
+    //! Bit-packed deltas
+    uint32_t *words;
+
+    //! Size of words array including padding
+    uint64_t numWords;
 };
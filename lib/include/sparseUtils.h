@@ -1,7 +1,12 @@
 #pragma once
 
 // Standard C++ includes
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 // Standard C includes
 #include <cmath>
@@ -141,6 +146,173 @@ void createSparseConnectivityFromDense(DATATYPE *wuvar, int preN, int postN, DAT
 }
 
 
+//--------------------------------------------------------------------------
+/*!
+  \brief Function type used to stream the dense weights of presynaptic neuron \p pre into \p row, which has space for postN entries
+*/
+//--------------------------------------------------------------------------
+template <class DATATYPE>
+using DenseRowFunc = std::function<void(unsigned int pre, DATATYPE *row)>;
+
+//--------------------------------------------------------------------------
+/*!
+  \brief Calls \p blockFunc with ranges of presynaptic neurons, distributing them between \p numThreads threads
+
+  If \p numThreads is zero, one thread is used per hardware thread
+*/
+//--------------------------------------------------------------------------
+void parallelForRowBlocks(unsigned int preN, unsigned int numThreads, std::function<void(unsigned int begin, unsigned int end)> blockFunc);
+
+//--------------------------------------------------------------------------
+/*!
+  \brief Creates a DenseRowFunc which reads rows from a file containing a row-major preN x postN matrix of DATATYPE
+
+  Rows can be read from multiple threads but reads are serialised
+*/
+//--------------------------------------------------------------------------
+template <class DATATYPE>
+DenseRowFunc<DATATYPE> denseRowsFromFile(const std::string &filename, unsigned int postN)
+{
+    struct File
+    {
+        ~File(){ if(file != NULL) fclose(file); }
+
+        FILE *file;
+        std::mutex mutex;
+    };
+
+    auto file = std::make_shared<File>();
+    file->file = fopen(filename.c_str(), "rb");
+    if (file->file == NULL) {
+        fprintf(stderr, "ERROR: Unable to open dense matrix file '%s'.\n", filename.c_str());
+        exit(1);
+    }
+
+    return [file, postN, filename](unsigned int pre, DATATYPE *row)
+    {
+        std::lock_guard<std::mutex> lock(file->mutex);
+        const long long offset = (long long)pre * postN * sizeof(DATATYPE);
+#ifdef _WIN32
+        const bool seekFailed = (_fseeki64(file->file, offset, SEEK_SET) != 0);
+#else
+        const bool seekFailed = (fseeko(file->file, (off_t)offset, SEEK_SET) != 0);
+#endif
+        if (seekFailed || fread(row, sizeof(DATATYPE), postN, file->file) != postN) {
+            fprintf(stderr, "ERROR: Unable to read row %u of dense matrix file '%s'.\n", pre, filename.c_str());
+            exit(1);
+        }
+    };
+}
+
+//--------------------------------------------------------------------------
+/*!
+  \brief Utility to build SPARSE connectivity from dense rows streamed by \p getRow without materialising the dense matrix
+
+  Rows are streamed and compacted in parallel in a single pass. Entries whose magnitude is above
+  GENN_PREFERENCES::asGoodAsZero become synapses so, unlike setSparseConnectivityFromDense, negative
+  weights are kept. Once the number of synapses is known, \p allocate (typically the generated
+  allocate<synapse population name> function) is called and the synapses are copied into \p sparseStruct
+  and \p *wuvar, which should point to the variable allocate sets.
+*/
+//--------------------------------------------------------------------------
+template <class DATATYPE>
+void createSparseConnectivityFromDenseRows(unsigned int preN, unsigned int postN, DenseRowFunc<DATATYPE> getRow,
+                                           std::function<void(unsigned int connN)> allocate, DATATYPE **wuvar,
+                                           SparseProjection *sparseStruct, unsigned int numThreads = 0)
+{
+    // Compact rows into per-block buffers as total number of synapses isn't known
+    struct Block
+    {
+        unsigned int begin;
+        std::vector<unsigned int> ind;
+        std::vector<DATATYPE> g;
+    };
+    std::vector<unsigned int> rowLength(preN);
+    std::vector<Block> blocks;
+    std::mutex blocksMutex;
+    parallelForRowBlocks(preN, numThreads,
+        [postN, &getRow, &rowLength, &blocks, &blocksMutex](unsigned int begin, unsigned int end)
+        {
+            Block block;
+            block.begin = begin;
+            std::vector<DATATYPE> row(postN);
+            for (unsigned int pre = begin; pre < end; pre++) {
+                getRow(pre, row.data());
+                const size_t rowBegin = block.ind.size();
+                for (unsigned int post = 0; post < postN; post++) {
+                    if (std::abs(row[post]) > GENN_PREFERENCES::asGoodAsZero) {
+                        block.ind.push_back(post);
+                        block.g.push_back(row[post]);
+                    }
+                }
+                rowLength[pre] = (unsigned int)(block.ind.size() - rowBegin);
+            }
+
+            std::lock_guard<std::mutex> lock(blocksMutex);
+            blocks.push_back(std::move(block));
+        });
+
+    // Allocate sparse structure and calculate row start indices
+    unsigned long long connN = 0;
+    for (unsigned int pre = 0; pre < preN; pre++) {
+        connN += rowLength[pre];
+    }
+    if (connN > 0xFFFFFFFFull) {
+        fprintf(stderr, "ERROR: %llu synapses is too many for a SPARSE synapse population.\n", connN);
+        exit(1);
+    }
+    allocate((unsigned int)connN);
+    sparseStruct->indInG[0] = 0;
+    for (unsigned int pre = 0; pre < preN; pre++) {
+        sparseStruct->indInG[pre + 1] = sparseStruct->indInG[pre] + rowLength[pre];
+    }
+
+    // Copy blocks into place
+    for (const auto &block : blocks) {
+        const unsigned int start = sparseStruct->indInG[block.begin];
+        std::copy(block.ind.cbegin(), block.ind.cend(), &sparseStruct->ind[start]);
+        std::copy(block.g.cbegin(), block.g.cend(), &(*wuvar)[start]);
+    }
+}
+
+//--------------------------------------------------------------------------
+/*!
+  \brief Utility to build RAGGED connectivity from dense rows streamed by \p getRow without materialising the dense matrix
+
+  As each row has a fixed location in the padded ragged arrays, rows are streamed and written directly
+  into place in parallel. Entries whose magnitude is above GENN_PREFERENCES::asGoodAsZero become synapses.
+*/
+//--------------------------------------------------------------------------
+template <class DATATYPE, typename PostIndexType, typename SynIndexType>
+void createRaggedConnectivityFromDenseRows(unsigned int preN, unsigned int postN, DenseRowFunc<DATATYPE> getRow,
+                                           DATATYPE *wuvar, RaggedProjection<PostIndexType, SynIndexType> *C,
+                                           unsigned int numThreads = 0)
+{
+    parallelForRowBlocks(preN, numThreads,
+        [postN, &getRow, wuvar, C](unsigned int begin, unsigned int end)
+        {
+            std::vector<DATATYPE> row(postN);
+            for (unsigned int pre = begin; pre < end; pre++) {
+                getRow(pre, row.data());
+                const SynIndexType rowStart = (SynIndexType)pre * C->maxRowLength;
+                unsigned int length = 0;
+                for (unsigned int post = 0; post < postN; post++) {
+                    if (std::abs(row[post]) > GENN_PREFERENCES::asGoodAsZero) {
+                        if (length == C->maxRowLength) {
+                            fprintf(stderr, "ERROR: Row %u of dense matrix has more than %u entries.\n", pre, C->maxRowLength);
+                            exit(1);
+                        }
+                        C->ind[rowStart + length] = post;
+                        wuvar[rowStart + length] = row[post];
+                        length++;
+                    }
+                }
+                C->rowLength[pre] = length;
+            }
+        });
+}
+
+
 //---------------------------------------------------------------------
 /*! \brief  Utility to generate the YALE array structure with post-to-pre arrangement from the original pre-to-post arrangement where postsynaptic feedback is necessary (learning etc)
  */
@@ -151,8 +323,8 @@ void createPosttoPreArray(unsigned int preN, unsigned int postN, SparseProjectio
 /*! \brief  Utility to generate the RAGGED array structure with post-to-pre arrangement from the original pre-to-post arrangement where postsynaptic feedback is necessary (learning etc)
  */
 //---------------------------------------------------------------------
-template<typename PostIndexType>
-void createPosttoPreArray(unsigned int preN, unsigned int postN, RaggedProjection<PostIndexType> * C)
+template<typename PostIndexType, typename SynIndexType>
+void createPosttoPreArray(unsigned int preN, unsigned int postN, RaggedProjection<PostIndexType, SynIndexType> * C)
 {
     // Zero column lengths
     std::fill_n(C->colLength, postN, 0);
@@ -162,13 +334,13 @@ void createPosttoPreArray(unsigned int preN, unsigned int postN, RaggedProjectio
         // Loop through synapses in corresponding matrix row
         for(unsigned int j = 0; j < C->rowLength[i]; j++) {
             // Calculate index of this synapse in the row-major matrix
-            const unsigned int rowMajorIndex = (i * C->maxRowLength) + j;
+            const SynIndexType rowMajorIndex = ((SynIndexType)i * C->maxRowLength) + j;
             
             // Using this, lookup postsynaptic target
             const unsigned int postIndex = C->ind[rowMajorIndex];
 
             // From this calculate index of this synapse in the column-major matrix
-            const unsigned int colMajorIndex = (postIndex * C->maxColLength) + C->colLength[postIndex];
+            const SynIndexType colMajorIndex = ((SynIndexType)postIndex * C->maxColLength) + C->colLength[postIndex];
             
             // Increment column length corresponding to this postsynaptic neuron
             C->colLength[postIndex]++;
@@ -178,6 +350,64 @@ void createPosttoPreArray(unsigned int preN, unsigned int postN, RaggedProjectio
         }
     }
 }
+//--------------------------------------------------------------------------
+/*! \brief Utility to free the arrays allocated by createDeltaIndices
+ */
+//--------------------------------------------------------------------------
+void freeDeltaIndices(DeltaProjection *D);
+
+//--------------------------------------------------------------------------
+/*! \brief Utility to delta-encode the sorted rows of RAGGED connectivity into a DeltaProjection
+
+Each row is stored with the smallest bit width which can hold the gaps between its postsynaptic
+indices. Any arrays previously allocated in \p D are freed first so this can be called repeatedly.
+ */
+//--------------------------------------------------------------------------
+template<typename PostIndexType, typename SynIndexType>
+void createDeltaIndices(unsigned int preN, const RaggedProjection<PostIndexType, SynIndexType> *C, DeltaProjection *D)
+{
+    freeDeltaIndices(D);
+    D->rowBase = new unsigned int[preN];
+    D->rowWidth = new uint8_t[preN];
+    D->rowStart = new uint64_t[preN + 1];
+
+    // Find the width required for each row's deltas and hence the number of words it occupies
+    D->rowStart[0] = 0;
+    for (unsigned int i = 0; i < preN; i++) {
+        const PostIndexType *row = &C->ind[(SynIndexType)i * C->maxRowLength];
+        unsigned int maxDelta = 0;
+        for (unsigned int j = 1; j < C->rowLength[i]; j++) {
+            if (row[j] < row[j - 1]) {
+                fprintf(stderr, "ERROR: Row %u of connectivity must be sorted to delta-encode it.\n", i);
+                exit(1);
+            }
+            maxDelta = std::max(maxDelta, (unsigned int)(row[j] - row[j - 1]));
+        }
+
+        unsigned int width = 0;
+        while (width < 32 && (maxDelta >> width) != 0) {
+            width++;
+        }
+        D->rowBase[i] = (C->rowLength[i] == 0) ? 0 : row[0];
+        D->rowWidth[i] = (uint8_t)width;
+        D->rowStart[i + 1] = D->rowStart[i] + ((((uint64_t)C->rowLength[i] * width) + 31) / 32);
+    }
+
+    // Pack deltas into words
+    D->numWords = D->rowStart[preN] + 1;
+    D->words = new uint32_t[D->numWords]();
+    for (unsigned int i = 0; i < preN; i++) {
+        const PostIndexType *row = &C->ind[(SynIndexType)i * C->maxRowLength];
+        uint32_t *rowWords = &D->words[D->rowStart[i]];
+        for (unsigned int j = 1; j < C->rowLength[i]; j++) {
+            const uint64_t bit = (uint64_t)j * D->rowWidth[i];
+            const uint64_t delta = (uint64_t)(row[j] - row[j - 1]) << (bit & 31);
+            rowWords[bit / 32] |= (uint32_t)delta;
+            rowWords[(bit / 32) + 1] |= (uint32_t)(delta >> 32);
+        }
+    }
+}
+
 //--------------------------------------------------------------------------
 /*! \brief Function to create the mapping from the normal index array "ind" to the "reverse" array revInd, i.e. the inverse mapping of remap. 
 This is needed if SynapseDynamics accesses pre-synaptic variables.
@@ -186,17 +416,17 @@ This is needed if SynapseDynamics accesses pre-synaptic variables.
 
 void createPreIndices(unsigned int preN, unsigned int postN, SparseProjection *C);
 
-template<typename PostIndexType>
-void createPreIndices(unsigned int preN, unsigned int, RaggedProjection<PostIndexType> * C)
+template<typename PostIndexType, typename SynIndexType>
+void createPreIndices(unsigned int preN, unsigned int, RaggedProjection<PostIndexType, SynIndexType> * C)
 {
-    unsigned int &synRemapCount = C->synRemap[0];
-    unsigned int *synRemap = &C->synRemap[1];
+    SynIndexType &synRemapCount = C->synRemap[0];
+    SynIndexType *synRemap = &C->synRemap[1];
     // Loop through presynaptic neurons
     synRemapCount  = 0;
     for (unsigned int i = 0; i < preN; i++) {
         // Loop through synapses in corresponding matrix row
         for(unsigned int j = 0; j < C->rowLength[i]; j++) {
-            synRemap[synRemapCount++] = (i * C->maxRowLength) + j;
+            synRemap[synRemapCount++] = ((SynIndexType)i * C->maxRowLength) + j;
         }
     }
 }
@@ -216,10 +446,10 @@ void initializeSparseArray(const SparseProjection &C,  unsigned int *dInd, unsig
 (by copying the values from the host)
  */
 //--------------------------------------------------------------------------
-template<typename PostIndexType>
-void initializeRaggedArray(const RaggedProjection<PostIndexType> &C, PostIndexType *dInd, unsigned int *dRowLength, unsigned int preN)
+template<typename PostIndexType, typename SynIndexType>
+void initializeRaggedArray(const RaggedProjection<PostIndexType, SynIndexType> &C, PostIndexType *dInd, unsigned int *dRowLength, unsigned int preN)
 {
-    CHECK_CUDA_ERRORS(cudaMemcpy(dInd, C.ind, C.maxRowLength * preN * sizeof(PostIndexType), cudaMemcpyHostToDevice));
+    CHECK_CUDA_ERRORS(cudaMemcpy(dInd, C.ind, (size_t)C.maxRowLength * preN * sizeof(PostIndexType), cudaMemcpyHostToDevice));
     CHECK_CUDA_ERRORS(cudaMemcpy(dRowLength, C.rowLength, preN * sizeof(unsigned int), cudaMemcpyHostToDevice));
 }
 
@@ -244,11 +474,11 @@ void initializeSparseArrayPreInd(const SparseProjection &C,  unsigned int * dPre
 (by copying the values from the host)
  */
 //--------------------------------------------------------------------------
-template<typename PostIndexType>
-void initializeRaggedArrayRev(const RaggedProjection<PostIndexType> &C, unsigned int *dColLength, unsigned int *dRemap, unsigned int postN)
+template<typename PostIndexType, typename SynIndexType>
+void initializeRaggedArrayRev(const RaggedProjection<PostIndexType, SynIndexType> &C, unsigned int *dColLength, SynIndexType *dRemap, unsigned int postN)
 {
     CHECK_CUDA_ERRORS(cudaMemcpy(dColLength, C.colLength, postN * sizeof(unsigned int), cudaMemcpyHostToDevice));
-    CHECK_CUDA_ERRORS(cudaMemcpy(dRemap, C.remap, C.maxColLength * postN * sizeof(unsigned int), cudaMemcpyHostToDevice));
+    CHECK_CUDA_ERRORS(cudaMemcpy(dRemap, C.remap, (size_t)C.maxColLength * postN * sizeof(SynIndexType), cudaMemcpyHostToDevice));
 }
 
 //--------------------------------------------------------------------------
@@ -256,9 +486,9 @@ void initializeRaggedArrayRev(const RaggedProjection<PostIndexType> &C, unsigned
 (by copying the values from the host)
  */
 //--------------------------------------------------------------------------
-template<typename PostIndexType>
-void initializeRaggedArraySynRemap(const RaggedProjection<PostIndexType> &C,  unsigned int *dSynRemap)
+template<typename PostIndexType, typename SynIndexType>
+void initializeRaggedArraySynRemap(const RaggedProjection<PostIndexType, SynIndexType> &C,  SynIndexType *dSynRemap)
 {
-    CHECK_CUDA_ERRORS(cudaMemcpy(dSynRemap, C.synRemap, (C.synRemap[0] + 1) * sizeof(unsigned int), cudaMemcpyHostToDevice));
+    CHECK_CUDA_ERRORS(cudaMemcpy(dSynRemap, C.synRemap, (C.synRemap[0] + 1) * sizeof(SynIndexType), cudaMemcpyHostToDevice));
 }
 #endif  // CPU_ONLY
\ No newline at end of file
@@ -76,6 +76,16 @@ void neuronThresholdCondition(
     const std::string &ftype,
     const std::string &rng);
 
+//! Applies standard set of variable substitutions to neuron model's "rest condition" code
+void neuronRestCondition(
+    std::string &rCode,
+    const NeuronGroup &ng,
+    const VarNameIterCtx &nmVars,
+    const DerivedParamNameIterCtx &nmDerivedParams,
+    const ExtraGlobalParamNameIterCtx &nmExtraGlobalParams,
+    const std::vector<FunctionTemplate> &functions,
+    const std::string &ftype);
+
 void neuronSim(
     std::string &sCode,
     const NeuronGroup &ng,
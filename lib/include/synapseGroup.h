@@ -69,6 +69,16 @@ public:
     /*! This is ignored for CPU simulations */
     void setWUVarMode(const std::string &varName, VarMode mode);
 
+    //! Set format used to store floating point weight update model state variable
+    /*! Use VarStorageType::HALF or VarStorageType::BFLOAT16 to halve the memory used by individual
+        per-synapse variables. This is only supported for CPU_ONLY simulations */
+    void setWUVarStorageType(const std::string &varName, VarStorageType type);
+
+    //! Store weight update model state variable as 8-bit indices into a codebook of distinct values
+    /*! Variables stored in a codebook must not be assigned to by the weight update model and
+        values written by user code are replaced by the nearest codebook entry. This is only supported for CPU_ONLY simulations */
+    void setWUVarCodebook(const std::string &varName, const std::vector<double> &values);
+
     //! Set variable mode of weight update model presynaptic state variable
     /*! This is ignored for CPU simulations */
     void setWUPreVarMode(const std::string &varName, VarMode mode);
@@ -103,6 +113,12 @@ public:
     
     //! Sets the maximum dendritic delay for synapses in this synapse group
     void setMaxDendriticDelayTimesteps(unsigned int maxDendriticDelay);
+
+    //! Store input being delayed along dendrites as a list of (postsynaptic neuron, value) pairs per delay slot rather than in a dense buffer
+    /*! Each slot's list is moved into inSyn before its target neurons are updated, so neurons with no pending
+        input are never touched and memory scales with the number of pending inputs rather than with the
+        maximum dendritic delay. This is only supported in CPU_ONLY simulations */
+    void setSparseDendriticDelayEnabled(bool enabled);
     
     //! Set how CUDA implementation is parallelised
     /*! with a thread per target neuron (default) or a thread per source spike */
@@ -111,6 +127,66 @@ public:
     //! Sets the number of delay steps used to delay postsynaptic spikes travelling back along dendrites to synapses
     void setBackPropDelaySteps(unsigned int timesteps);
 
+    //! Restrict synapse dynamics to the rows of presynaptic neurons which have spiked within the last \p timesteps
+    /*! Rows of quiescent presynaptic neurons are skipped, leaving their synapse state frozen until the neuron next spikes.
+        Setting this to 0 (the default) updates every synapse every timestep. This is only used for CPU simulations */
+    void setSynapseDynamicsActivityWindow(unsigned int timesteps);
+
+    //! Only apply synapse dynamics every \p timesteps
+    /*! DT in the synapse dynamics code is scaled accordingly but, as they are shared with the
+        weight update model's other code, derived parameters are not. This is only supported for CPU_ONLY simulations */
+    void setSynapseDynamicsUpdateInterval(unsigned int timesteps);
+
+    //! Only apply synapse dynamics to synapses whose weight update model variable \p varName is non-zero
+    /*! A bitmask of these synapses is built when init<model name>() is called, so synapses
+        which are zero then are treated as structurally absent for the rest of the simulation.
+        This is only supported for DENSE_INDIVIDUALG synapse groups in CPU_ONLY simulations */
+    void setSynapseDynamicsSkipMaskVar(const std::string &varName);
+
+    //! Store this synapse group's connectivity and weights in memory-mapped files rather than in RAM
+    /*! Rows are paged in from disk as their presynaptic neurons spike so models larger than host memory can be simulated.
+        Files are created in GENN_PREFERENCES::outOfCoreDirectory. This is only supported for static
+        YALE or RAGGED synapse groups in CPU_ONLY simulations on POSIX systems */
+    void setOutOfCore(bool outOfCore);
+
+    //! Load the weights stored in connectivity files into weight update model variable \p varName
+    /*! Weights are only loaded by the generated load<synapse population name>Connectivity function if this has been
+        set. \p varName must be an individual floating point variable and should be initialised with uninitialisedVar() */
+    void setConnectivityFileWeightVar(const std::string &varName);
+
+    //! Process spikes against blocks of \p numNeurons postsynaptic neurons at a time and prefetch the rows of upcoming spikes
+    /*! Keeping the block of postsynaptic input being accumulated into in cache can speed up large, densely-spiking
+        projections. Setting this to 0 (the default) processes each spike's entire row at once. This is only used for CPU simulations */
+    void setCacheBlockSize(unsigned int numNeurons){ m_CacheBlockSize = numNeurons; }
+
+    //! Propagate spikes using a copy of the connectivity in which each row's postsynaptic indices are stored as bit-packed deltas
+    /*! Rows are encoded using the fewest bits which can hold the gaps between their (sorted) postsynaptic
+        indices when init<model name>() is called, so the connectivity must not change after this.
+        The copy is stored alongside ind so, unless \p freeInd is set, this increases memory usage.
+        If \p freeInd is set, ind is freed once the copy has been built so it cannot be accessed from user code
+        and init<model name>() can only be called once. This requires a group without postsynaptic learning
+        or synapse dynamics. This is only supported for RAGGED synapse groups in CPU_ONLY simulations */
+    void setDeltaEncodingEnabled(bool enabled, bool freeInd = false);
+
+    //! Split the spikes propagated through this synapse group each timestep between \p numThreads threads
+    /*! Each thread accumulates input into a private copy of inSyn (or of the dendritic delay buffer), which is
+        then added into the shared buffer with the postsynaptic neurons split between the threads.
+        This helps when propagation can't be partitioned by postsynaptic neuron, but the copies cost numThreads - 1 times
+        the size of these buffers to reduce every timestep, so it is only worthwhile if many synapses are processed
+        per postsynaptic neuron. Synapse groups which process spike-like events, have postsynaptic weight update
+        model variables or generate random numbers can't be split. This is only supported in CPU_ONLY simulations */
+    void setSpikePropagationThreads(unsigned int numThreads);
+
+    //! Store weight update model parameter in a variable which can be changed at runtime rather than embedding it in the generated code
+    /*! Derived parameters which depend on it will also be stored in variables. These are named
+        by appending the synapse group name to the parameter name */
+    void setWUParamDynamic(const std::string &paramName, bool dynamic = true);
+
+    //! Store postsynaptic model parameter in a variable which can be changed at runtime rather than embedding it in the generated code
+    /*! Derived parameters which depend on it will also be stored in variables. These are named
+        by appending the synapse group name to the parameter name */
+    void setPSParamDynamic(const std::string &paramName, bool dynamic = true);
+
     void initDerivedParams(double dt);
     void calcKernelSizes(unsigned int blockSize, unsigned int &paddedKernelIDStart);
 
@@ -127,6 +203,19 @@ public:
     unsigned int getMaxConnections() const{ return m_MaxConnections; }
     unsigned int getMaxSourceConnections() const{ return m_MaxSourceConnections; }
     unsigned int getMaxDendriticDelayTimesteps() const{ return m_MaxDendriticDelayTimesteps; }
+    unsigned int getSynapseDynamicsActivityWindow() const{ return m_SynapseDynamicsActivityWindow; }
+    unsigned int getSynapseDynamicsUpdateInterval() const{ return m_SynapseDynamicsUpdateInterval; }
+    const std::string &getSynapseDynamicsSkipMaskVar() const{ return m_SynapseDynamicsSkipMaskVar; }
+    const std::string &getConnectivityFileWeightVar() const{ return m_ConnectivityFileWeightVar; }
+    bool isOutOfCore() const{ return m_OutOfCore; }
+    unsigned int getCacheBlockSize() const{ return m_CacheBlockSize; }
+    bool isDeltaEncodingEnabled() const{ return m_DeltaEncodingEnabled; }
+    bool isDeltaEncodingIndFreed() const{ return m_DeltaEncodingIndFreed; }
+    bool isSparseDendriticDelayEnabled() const{ return m_SparseDendriticDelayEnabled; }
+    unsigned int getSpikePropagationThreads() const{ return m_SpikePropagationThreads; }
+
+    //! Are spikes processed against blocks of postsynaptic neurons rather than entire rows
+    bool isCacheBlocked() const;
     SynapseMatrixType getMatrixType() const{ return m_MatrixType; }
 
     //! Get variable mode used for variables used to combine input from this synapse group
@@ -167,6 +256,23 @@ public:
     const std::vector<NewModels::VarInit> &getPSVarInitialisers() const{ return m_PSVarInitialisers; }
     const std::vector<double> getPSConstInitVals() const;
 
+    //! Which weight update model parameters and derived parameters are stored in variables which can be changed at runtime
+    const std::vector<bool> &getWUParamDynamic() const{ return m_WUParamDynamic; }
+    const std::vector<bool> &getWUDerivedParamDynamic() const{ return m_WUDerivedParamDynamic; }
+
+    //! Which postsynaptic model parameters and derived parameters are stored in variables which can be changed at runtime
+    const std::vector<bool> &getPSParamDynamic() const{ return m_PSParamDynamic; }
+    const std::vector<bool> &getPSDerivedParamDynamic() const{ return m_PSDerivedParamDynamic; }
+
+    //! Are any postsynaptic model parameters stored in variables which can be changed at runtime
+    bool isPSParamDynamicRequired() const;
+
+    //! Get names and initial values of variables used to store parameters which can be changed at runtime
+    std::vector<std::pair<std::string, double>> getDynamicParamValues() const;
+
+    //! Get names of parameters which can be changed at runtime along with the names of the derived parameters which depend on them
+    std::vector<std::pair<std::string, std::vector<std::string>>> getDynamicParamDependents() const;
+
     const InitSparseConnectivitySnippet::Init &getConnectivityInitialiser() const{ return m_ConnectivityInitialiser; }
 
     const std::string &getPSModelTargetName() const{ return m_PSModelTargetName; }
@@ -182,6 +288,29 @@ public:
     //! Get variable mode used by weight update model per-synapse state variable
     VarMode getWUVarMode(size_t index) const{ return m_WUVarMode[index]; }
 
+    //! Get format used to store weight update model per-synapse state variable
+    VarStorageType getWUVarStorageType(const std::string &var) const;
+
+    //! Get sorted codebook values used to store weight update model per-synapse state variable
+    const std::vector<double> &getWUVarCodebook(const std::string &var) const;
+
+    //! Get type used to declare storage for weight update model per-synapse state variable
+    std::string getWUVarStorageTypeName(const std::string &var) const;
+
+    //! Are any weight update model per-synapse state variables stored in a reduced precision format
+    bool isWUVarReducedPrecisionStorageRequired() const;
+
+    //! Are 64-bit integers required to index this synapse group's per-synapse arrays
+    /*! This is the case if the padded row-major arrays (or the column-major
+        remapping array) of RAGGED and DENSE matrices have more than 2^32 entries */
+    bool isSynapseIndex64BitRequired() const;
+
+    //! Get type used to index this synapse group's per-synapse arrays
+    std::string getSynapseIndexType() const{ return isSynapseIndex64BitRequired() ? "uint64_t" : "unsigned int"; }
+
+    //! Get stride literal which, when multiplied by a row or column index, yields a synapse index of the correct width
+    std::string getSynapseIndexStride(unsigned int stride) const;
+
     //! Get variable mode used by weight update model presynaptic state variable
     VarMode getWUPreVarMode(const std::string &var) const;
 
@@ -216,9 +345,18 @@ public:
 
     std::string getDendriticDelayOffset(const std::string &devPrefix, const std::string &offset = "") const;
 
+    //! Get the CPU code used to implement addToInSynDelay for postsynaptic neuron \p postIdx
+    std::string getDendriticDelayAddCode(const std::string &postIdx) const;
+
     //! Does this synapse group require dendritic delay?
     bool isDendriticDelayRequired() const;
 
+    //! Are synapse dynamics only applied to the rows of recently active presynaptic neurons?
+    bool isSynapseDynamicsActivityGated() const{ return (m_SynapseDynamicsActivityWindow > 0); }
+
+    //! Are synapse dynamics only applied to synapses set in a bitmask
+    bool isSynapseDynamicsSkipMaskEnabled() const{ return !m_SynapseDynamicsSkipMaskVar.empty(); }
+
     //! Does this synapse group require an RNG for it's postsynaptic init code?
     bool isPSInitRNGRequired(VarInit varInitMode) const;
 
@@ -246,6 +384,10 @@ public:
     //! Is any form of sparse device initialisation required?
     bool isDeviceSparseInitRequired() const;
 
+    //! Can this synapse group's connectivity be loaded from a file written using ConnectivityFile?
+    /*! This requires sparse connectivity which is stored on the host and not built by a connectivity initialisation snippet */
+    bool isConnectivityFileLoadSupported() const;
+
     //! Can this synapse group run on the CPU?
     /*! If we are running in CPU_ONLY mode this is always true,
         but some GPU functionality will prevent models being run on both CPU and GPU.*/
@@ -288,6 +430,36 @@ private:
 
     //!< Maximum dendritic delay timesteps supported for synapses in this population
     unsigned int m_MaxDendriticDelayTimesteps;
+
+    //!< Number of timesteps after a presynaptic spike for which synapse dynamics are applied to its row (0 to always apply)
+    unsigned int m_SynapseDynamicsActivityWindow;
+
+    //!< Number of timesteps between applications of synapse dynamics
+    unsigned int m_SynapseDynamicsUpdateInterval;
+
+    //!< Name of weight update model variable whose non-zero synapses synapse dynamics are applied to (empty to apply to all)
+    std::string m_SynapseDynamicsSkipMaskVar;
+
+    //!< Name of weight update model variable weights in connectivity files are loaded into (empty to not load weights)
+    std::string m_ConnectivityFileWeightVar;
+
+    //!< Are connectivity and weights stored in memory-mapped files
+    bool m_OutOfCore;
+
+    //!< Number of postsynaptic neurons processed at a time when propagating spikes (0 to process entire rows)
+    unsigned int m_CacheBlockSize;
+
+    //!< Are spikes propagated using delta-encoded postsynaptic indices
+    bool m_DeltaEncodingEnabled;
+
+    //!< Is ind freed once the delta-encoded postsynaptic indices have been built
+    bool m_DeltaEncodingIndFreed;
+
+    //!< Is dendritically delayed input stored in per-slot lists rather than a dense buffer
+    bool m_SparseDendriticDelayEnabled;
+
+    //!< Number of threads spikes are propagated on, each accumulating input into its own copy of inSyn
+    unsigned int m_SpikePropagationThreads;
     
     //!< Connectivity type of synapses
     SynapseMatrixType m_MatrixType;
@@ -322,6 +494,13 @@ private:
     //!< Derived parameters for weight update model
     std::vector<double> m_WUDerivedParams;
 
+    //!< Which weight update model parameters and derived parameters are stored in variables rather than embedded in code
+    std::vector<bool> m_WUParamDynamic;
+    std::vector<bool> m_WUDerivedParamDynamic;
+
+    //!< Indices of the weight update model derived parameters which depend on each parameter stored in a variable
+    std::vector<std::vector<size_t>> m_WUDerivedParamDependencies;
+
     //!< Initialisers for weight update model per-synapse variables
     std::vector<NewModels::VarInit> m_WUVarInitialisers;
 
@@ -340,12 +519,25 @@ private:
     //!< Derived parameters for post synapse model
     std::vector<double> m_PSDerivedParams;
 
+    //!< Which post synapse model parameters and derived parameters are stored in variables rather than embedded in code
+    std::vector<bool> m_PSParamDynamic;
+    std::vector<bool> m_PSDerivedParamDynamic;
+
+    //!< Indices of the post synapse model derived parameters which depend on each parameter stored in a variable
+    std::vector<std::vector<size_t>> m_PSDerivedParamDependencies;
+
     //!< Initialisers for post synapse model variables
     std::vector<NewModels::VarInit> m_PSVarInitialisers;
 
     //!< Whether individual per-synapse state variables of weight update model should use zero-copied memory
     std::vector<VarMode> m_WUVarMode;
 
+    //!< Formats used to store individual per-synapse state variables of weight update model
+    std::vector<VarStorageType> m_WUVarStorageType;
+
+    //!< Codebooks used to store individual per-synapse state variables of weight update model
+    std::vector<std::vector<double>> m_WUVarCodebooks;
+
     //!< Whether individual presynaptic state variables of weight update model should use zero-copied memory
     std::vector<VarMode> m_WUPreVarMode;
 
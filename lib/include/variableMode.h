@@ -31,6 +31,16 @@ enum class VarMode : uint8_t
     LOC_ZERO_COPY_INIT_DEVICE   = static_cast<uint8_t>(VarLocation::HOST) | static_cast<uint8_t>(VarLocation::DEVICE) | static_cast<uint8_t>(VarLocation::ZERO_COPY) | static_cast<uint8_t>(VarInit::DEVICE),
 };
 
+//!< Formats in which floating point state variables can be stored
+/*! Reduced precision formats are converted to and from the model precision when they are read and written */
+enum class VarStorageType : uint8_t
+{
+    DEFAULT,    //!< Store using the type specified by the model
+    HALF,       //!< IEEE 754 half precision (5 exponent bits, 10 mantissa bits)
+    BFLOAT16,   //!< Brain floating point (8 exponent bits, 7 mantissa bits)
+    CODEBOOK8,  //!< 8-bit index into a per-synapse group table of up to 256 values
+};
+
 //----------------------------------------------------------------------------
 // Operators
 //----------------------------------------------------------------------------
@@ -0,0 +1,87 @@
+#pragma once
+
+// Standard C++ includes
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+//----------------------------------------------------------------------------
+// WorkerThread
+//----------------------------------------------------------------------------
+//! Thread which runs tasks on behalf of the simulation thread so they can overlap with its own work
+class WorkerThread
+{
+public:
+    WorkerThread() : m_Busy(false), m_Quit(false), m_Thread(&WorkerThread::run, this)
+    {
+    }
+
+    ~WorkerThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Quit = true;
+        }
+        m_Condition.notify_all();
+        m_Thread.join();
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Start running task on the worker thread
+    /*! Any previously started task must have been waited for */
+    void start(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Task = task;
+            m_Busy = true;
+        }
+        m_Condition.notify_all();
+    }
+
+    //! Wait for the most recently started task to complete
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Condition.wait(lock, [this](){ return !m_Busy; });
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        while(true) {
+            m_Condition.wait(lock, [this](){ return m_Busy || m_Quit; });
+            if(m_Quit) {
+                return;
+            }
+
+            // Run task without holding lock
+            lock.unlock();
+            m_Task();
+            lock.lock();
+
+            // Signal completion
+            m_Busy = false;
+            m_Condition.notify_all();
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::function<void()> m_Task;
+    bool m_Busy;
+    bool m_Quit;
+
+    // **NOTE** declared last so it is started after the other members are initialised
+    std::thread m_Thread;
+};
@@ -18,7 +18,12 @@
     #error "GeNN now requires a functioning std::regex implementation - please upgrade your version of GCC to at least 4.9.1"
 #endif
 
+// Standard C++ includes
+#include <algorithm>
+#include <map>
+
 // Standard C includes
+#include <cctype>
 #include <cstring>
 
 // GeNN includes
@@ -105,7 +110,8 @@ GenericFunction randomFuncs[] = {
     {"gennrand_normal", 0},
     {"gennrand_exponential", 0},
     {"gennrand_log_normal", 2},
-    {"gennrand_gamma", 1}
+    {"gennrand_gamma", 1},
+    {"gennrand_binomial", 2}
 };
 
 //--------------------------------------------------------------------------
@@ -115,7 +121,8 @@ GenericFunction randomFuncs[] = {
 void ensureMathFunctionFtype(string &code, const string &type)
 {
     // If type is double, substitute any single precision maths functions for double precision version
-    if (type == "double") {
+    // **NOTE** fixed-point types provide overloads of the double precision maths functions
+    if (type == "double" || isFixedPointType(type)) {
         for(const auto &m : mathsFuncs) {
             regexFuncSubstitute(code, m[MathsFuncSingle], m[MathsFuncDouble]);
         }
@@ -158,6 +165,7 @@ void neuronSubstitutionsInSynapticCode(
     string &wCode, //!< the code string to work on
     const NeuronGroup *ng,
     const string &offset,
+    const string &spikeTimeOffset,
     const string &delayOffset,
     const string &idx,
     const string &sourceSuffix,
@@ -168,17 +176,18 @@ void neuronSubstitutionsInSynapticCode(
     // presynaptic neuron variables, parameters, and global parameters
     const auto *neuronModel = ng->getNeuronModel();
     substitute(wCode, "$(sT" + sourceSuffix + ")",
-               "(" + delayOffset + varPrefix + devPrefix+ "sT" + ng->getName() + "[" + offset + idx + "]" + varSuffix + ")");
+               "(" + delayOffset + ng->getSpikeTimeValue(varPrefix + devPrefix+ "sT" + ng->getName() + "[" + spikeTimeOffset + idx + "]" + varSuffix) + ")");
     for(const auto &v : neuronModel->getVars()) {
         const std::string varIdx = ng->isVarQueueRequired(v.first) ? offset + idx : idx;
 
         substitute(wCode, "$(" + v.first + sourceSuffix + ")",
                    varPrefix + devPrefix + v.first + ng->getName() + "[" + varIdx + "]" + varSuffix);
     }
-    value_substitutions(wCode, neuronModel->getParamNames(), ng->getParams(), sourceSuffix);
+    param_substitutions(wCode, neuronModel->getParamNames(), ng->getParams(), ng->getParamDynamic(), ng->getName(), sourceSuffix);
 
     DerivedParamNameIterCtx preDerivedParams(neuronModel->getDerivedParams());
-    value_substitutions(wCode, preDerivedParams.nameBegin, preDerivedParams.nameEnd, ng->getDerivedParams(), sourceSuffix);
+    param_substitutions(wCode, preDerivedParams.nameBegin, preDerivedParams.nameEnd, ng->getDerivedParams(),
+                        ng->getDerivedParamDynamic(), ng->getName(), sourceSuffix);
 
     ExtraGlobalParamNameIterCtx preExtraGlobalParams(neuronModel->getExtraGlobalParams());
     name_substitutions(wCode, "", preExtraGlobalParams.nameBegin, preExtraGlobalParams.nameEnd, ng->getName(), sourceSuffix);
@@ -226,6 +235,119 @@ bool regexSubstitute(string &s, const std::regex &regex, const std::string &form
         return true;
     }
 }
+
+bool isIdentifierStart(char c)
+{
+    return (std::isalpha(c) || c == '_');
+}
+
+bool isIdentifierChar(char c)
+{
+    return (std::isalnum(c) || c == '_');
+}
+
+//--------------------------------------------------------------------------
+//! \brief Returns the end of the identifier or numeric literal starting at pos
+//--------------------------------------------------------------------------
+size_t getTokenEnd(const string &code, size_t pos)
+{
+    // If token is a numeric literal, also consume decimal points and signed exponents
+    if(std::isdigit(code[pos]) || code[pos] == '.') {
+        const bool hex = (code.compare(pos, 2, "0x") == 0 || code.compare(pos, 2, "0X") == 0);
+        size_t end = pos + 1;
+        while(end < code.size()) {
+            const char c = code[end];
+            const char prev = code[end - 1];
+            if(isIdentifierChar(c) || c == '.'
+                || (!hex && (c == '+' || c == '-') && (prev == 'e' || prev == 'E')))
+            {
+                end++;
+            }
+            else {
+                break;
+            }
+        }
+        return end;
+    }
+    else {
+        size_t end = pos + 1;
+        while(end < code.size() && isIdentifierChar(code[end])) {
+            end++;
+        }
+        return end;
+    }
+}
+
+bool isMathsFunction(const string &name)
+{
+    for(const auto &m : mathsFuncs) {
+        if(name == m[MathsFuncDouble] || name == m[MathsFuncSingle]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//--------------------------------------------------------------------------
+//! \brief Returns the position of the bracket closing the one at openPos or npos if it is unbalanced
+//--------------------------------------------------------------------------
+size_t findClosingBracket(const string &code, size_t openPos)
+{
+    int depth = 0;
+    for(size_t i = openPos; i < code.size(); i++) {
+        if(code[i] == '(') {
+            depth++;
+        }
+        else if(code[i] == ')') {
+            depth--;
+            if(depth == 0) {
+                return i;
+            }
+        }
+    }
+    return string::npos;
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Determines whether an expression is built only from literals, invariant identifiers and maths functions
+
+  Anything else - array accesses, member accesses, comparisons, other function calls and so on - is
+  conservatively assumed to vary between iterations.
+ */
+//--------------------------------------------------------------------------
+bool isInvariantExpression(const string &expression, const std::set<string> &invariantIdentifiers)
+{
+    size_t i = 0;
+    while(i < expression.size()) {
+        const char c = expression[i];
+        if(std::isspace(c) || std::strchr("+-*/%(),", c) != nullptr) {
+            i++;
+        }
+        else if(std::isdigit(c) || c == '.') {
+            i = getTokenEnd(expression, i);
+        }
+        else if(isIdentifierStart(c)) {
+            const size_t end = getTokenEnd(expression, i);
+            const string identifier = expression.substr(i, end - i);
+
+            // Skip whitespace to see whether identifier is being called
+            size_t next = end;
+            while(next < expression.size() && std::isspace(expression[next])) {
+                next++;
+            }
+            const bool call = (next < expression.size() && expression[next] == '(');
+
+            if(call ? !isMathsFunction(identifier) : (invariantIdentifiers.find(identifier) == invariantIdentifiers.cend())) {
+                return false;
+            }
+            i = end;
+        }
+        else {
+            return false;
+        }
+    }
+    return true;
+}
 }    // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -274,6 +396,16 @@ bool regexFuncSubstitute(string &s, const string &trg, const string &rep)
     return regexSubstitute(s, regex, format);
 }
 
+//--------------------------------------------------------------------------
+//! \brief Tool for scaling the timestep DT in code which is only evaluated every updateInterval timesteps
+//--------------------------------------------------------------------------
+void substituteUpdateIntervalDT(string &code, unsigned int updateInterval)
+{
+    if (updateInterval > 1) {
+        regexVarSubstitute(code, "DT", "(" + to_string(updateInterval) + " * DT)");
+    }
+}
+
 //--------------------------------------------------------------------------
 //! \brief Does the code string contain any functions requiring random number generator
 //--------------------------------------------------------------------------
@@ -572,6 +704,99 @@ void checkUnreplacedVariables(const string &code, const string &codeName)
     }
 }
 
+//--------------------------------------------------------------------------
+/*! \brief This function hoists calls to maths functions whose arguments cannot change within a block of code out of it
+
+  Every call to a maths function whose arguments consist only of literals, identifiers in invariantIdentifiers
+  which are not assigned to within code and nested calls to other maths functions is replaced with a
+  constant named prefix followed by a number. Textually identical calls share a single constant.
+ */
+//--------------------------------------------------------------------------
+string hoistInvariantExpressions(string &code, const std::set<string> &invariantIdentifiers, const string &prefix)
+{
+    // Identifiers which are assigned to within the code can't be treated as invariant
+    std::set<string> invariants;
+    for(const auto &i : invariantIdentifiers) {
+        const std::regex assignment("\\b" + i + "\\s*([-+*/%&|^]|<<|>>)?=[^=]|(\\+\\+|--)\\s*" + i + "\\b|\\b" + i + "\\s*(\\+\\+|--)");
+        if(!std::regex_search(code, assignment)) {
+            invariants.insert(i);
+        }
+    }
+
+    // Map of expressions (with whitespace removed) to the names of the constants they are hoisted into
+    std::map<string, string> hoisted;
+    std::ostringstream declarations;
+    string output;
+    size_t i = 0;
+    while(i < code.size()) {
+        const char c = code[i];
+
+        // Copy string and character literals verbatim
+        if(c == '"' || c == '\'') {
+            size_t end = i + 1;
+            while(end < code.size() && code[end] != c) {
+                end += (code[end] == '\\') ? 2 : 1;
+            }
+            end = std::min(end + 1, code.size());
+            output.append(code, i, end - i);
+            i = end;
+        }
+        // Copy numeric literals verbatim so their suffixes aren't mistaken for identifiers
+        else if(std::isdigit(c)) {
+            const size_t end = getTokenEnd(code, i);
+            output.append(code, i, end - i);
+            i = end;
+        }
+        else if(isIdentifierStart(c)) {
+            const size_t end = getTokenEnd(code, i);
+            const string identifier = code.substr(i, end - i);
+
+            // Calls to members or functions in other namespaces are not maths functions
+            const bool qualified = (i > 0 && (code[i - 1] == '.'
+                                              || (i > 1 && code[i - 1] == ':' && code[i - 2] == ':')
+                                              || (i > 1 && code[i - 1] == '>' && code[i - 2] == '-')));
+
+            // If identifier is a call to a maths function
+            size_t open = end;
+            while(open < code.size() && std::isspace(code[open])) {
+                open++;
+            }
+            if(!qualified && open < code.size() && code[open] == '(' && isMathsFunction(identifier)) {
+                // If the call's arguments are invariant
+                const size_t close = findClosingBracket(code, open);
+                if(close != string::npos && isInvariantExpression(code.substr(open + 1, close - open - 1), invariants)) {
+                    const string expression = code.substr(i, close + 1 - i);
+                    string key = expression;
+                    key.erase(std::remove_if(key.begin(), key.end(), [](char k){ return std::isspace(k); }), key.end());
+
+                    // If this expression hasn't been encountered before, declare a new constant to hold it
+                    auto h = hoisted.find(key);
+                    if(h == hoisted.cend()) {
+                        const string name = prefix + std::to_string(hoisted.size());
+                        h = hoisted.emplace(key, name).first;
+                        declarations << "const auto " << name << " = " << expression << ";" << std::endl;
+                    }
+
+                    // Replace expression with constant
+                    output += h->second;
+                    i = close + 1;
+                    continue;
+                }
+            }
+
+            output += identifier;
+            i = end;
+        }
+        else {
+            output += c;
+            i++;
+        }
+    }
+
+    code = output;
+    return declarations.str();
+}
+
 //--------------------------------------------------------------------------
 /*! \brief This function returns the 32-bit hash of a string - because these are used across MPI nodes which may have different libstdc++ it would be risky to use std::hash
  */
@@ -646,6 +871,7 @@ void preNeuronSubstitutionsInSynapticCode(
     string &wCode, //!< the code string to work on
     const SynapseGroup *sg,
     const string &offset,
+    const string &spikeTimeOffset,
     const string &axonalDelayOffset,
     const string &preIdx,
     const string &devPrefix, //!< device prefix, "dd_" for GPU, nothing for CPU
@@ -658,13 +884,14 @@ void preNeuronSubstitutionsInSynapticCode(
         substitute(wCode, "$(V_pre)", to_string(sg->getSrcNeuronGroup()->getParams()[2]));
     }
 
-    neuronSubstitutionsInSynapticCode(wCode, sg->getSrcNeuronGroup(), offset, axonalDelayOffset, preIdx, "_pre", devPrefix, preVarPrefix, preVarSuffix);
+    neuronSubstitutionsInSynapticCode(wCode, sg->getSrcNeuronGroup(), offset, spikeTimeOffset, axonalDelayOffset, preIdx, "_pre", devPrefix, preVarPrefix, preVarSuffix);
 }
 
 void postNeuronSubstitutionsInSynapticCode(
     string &wCode, //!< the code string to work on
     const SynapseGroup *sg,
     const string &offset,
+    const string &spikeTimeOffset,
     const string &backPropDelayOffset,
     const string &postIdx,
     const string &devPrefix, //!< device prefix, "dd_" for GPU, nothing for CPU
@@ -672,7 +899,7 @@ void postNeuronSubstitutionsInSynapticCode(
     const string &postVarSuffix)    //!< suffix to be used for postsynaptic variable accesses - typically combined with prefix to wrap in function call such as __ldg(&XXX)
 {
     // postsynaptic neuron variables, parameters, and global parameters
-    neuronSubstitutionsInSynapticCode(wCode, sg->getTrgNeuronGroup(), offset, backPropDelayOffset, postIdx, "_post", devPrefix, postVarPrefix, postVarSuffix);
+    neuronSubstitutionsInSynapticCode(wCode, sg->getTrgNeuronGroup(), offset, spikeTimeOffset, backPropDelayOffset, postIdx, "_post", devPrefix, postVarPrefix, postVarSuffix);
 }
 
 void neuron_substitutions_in_synaptic_code(
@@ -689,9 +916,13 @@ void neuron_substitutions_in_synaptic_code(
 {
     const std::string axonalDelayOffset = writePreciseString(dt * (double)(sg->getDelaySteps() + 1)) + " + ";
     const std::string preOffset = sg->getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
-    preNeuronSubstitutionsInSynapticCode(wCode, sg, preOffset, axonalDelayOffset, preIdx, devPrefix, preVarPrefix, preVarSuffix);
+    const std::string preSpikeTimeOffset = sg->getSrcNeuronGroup()->isVersionedDelayQueueRequired()
+        ? sg->getSrcNeuronGroup()->getVersionedQueueOffset(preIdx, sg->getDelaySteps()) + " + " : preOffset;
+    preNeuronSubstitutionsInSynapticCode(wCode, sg, preOffset, preSpikeTimeOffset, axonalDelayOffset, preIdx, devPrefix, preVarPrefix, preVarSuffix);
     
     const std::string backPropDelayMs = writePreciseString(dt * (double)(sg->getBackPropDelaySteps() + 1)) + " + ";
     const std::string postOffset = sg->getTrgNeuronGroup()->isDelayRequired() ? "postReadDelayOffset + " : "";
-    postNeuronSubstitutionsInSynapticCode(wCode, sg, postOffset, backPropDelayMs, postIdx, devPrefix, postVarPrefix, postVarSuffix);
+    const std::string postSpikeTimeOffset = sg->getTrgNeuronGroup()->isVersionedDelayQueueRequired()
+        ? sg->getTrgNeuronGroup()->getVersionedQueueOffset(postIdx, sg->getBackPropDelaySteps()) + " + " : postOffset;
+    postNeuronSubstitutionsInSynapticCode(wCode, sg, postOffset, postSpikeTimeOffset, backPropDelayMs, postIdx, devPrefix, postVarPrefix, postVarSuffix);
 }
@@ -0,0 +1,119 @@
+#include "functionTable.h"
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+// GeNN includes
+#include "utils.h"
+
+//------------------------------------------------------------------------
+// FunctionTable
+//------------------------------------------------------------------------
+FunctionTable::FunctionTable(const std::string &functionName, std::function<double(double)> function,
+                             double min, double max, unsigned int numIntervals, Interpolation interpolation)
+    : m_FunctionName(functionName), m_Function(function), m_Min(min), m_Max(max),
+      m_NumIntervals(numIntervals), m_Interpolation(interpolation)
+{
+    if(!m_Function) {
+        gennError("FunctionTable: No implementation provided for '" + functionName + "' and it is not a standard maths function.");
+    }
+    if(!(min < max)) {
+        gennError("FunctionTable: Range of table for '" + functionName + "' must have min < max.");
+    }
+    if(numIntervals == 0) {
+        gennError("FunctionTable: Table for '" + functionName + "' must have at least one interval.");
+    }
+}
+//------------------------------------------------------------------------
+bool FunctionTable::isMathsFunction() const
+{
+    return static_cast<bool>(getMathsFunction(m_FunctionName));
+}
+//------------------------------------------------------------------------
+std::vector<double> FunctionTable::getEntries() const
+{
+    const double step = (m_Max - m_Min) / (double)m_NumIntervals;
+
+    // Cubic interpolation also needs the points on either side of each interval
+    const int first = (m_Interpolation == Interpolation::CUBIC) ? -1 : 0;
+    const int last = (m_Interpolation == Interpolation::CUBIC) ? (int)m_NumIntervals + 1 : (int)m_NumIntervals;
+
+    std::vector<double> entries;
+    entries.reserve(last - first + 1);
+    for(int i = first; i <= last; i++) {
+        entries.push_back(m_Function(m_Min + (step * (double)i)));
+    }
+    return entries;
+}
+//------------------------------------------------------------------------
+double FunctionTable::interpolate(const std::vector<double> &entries, double x) const
+{
+    // Get position within table and split into index and fraction
+    const double pos = (x - m_Min) * ((double)m_NumIntervals / (m_Max - m_Min));
+    const unsigned int i = std::min((unsigned int)pos, m_NumIntervals - 1);
+    const double f = pos - (double)i;
+
+    if(m_Interpolation == Interpolation::LINEAR) {
+        return entries[i] + (f * (entries[i + 1] - entries[i]));
+    }
+    else {
+        // **NOTE** entries are offset by one so entries[i] is the point before the interval
+        const double p0 = entries[i];
+        const double p1 = entries[i + 1];
+        const double p2 = entries[i + 2];
+        const double p3 = entries[i + 3];
+        return p1 + (0.5 * f * ((p2 - p0) + (f * (((2.0 * p0) - (5.0 * p1) + (4.0 * p2) - p3) + (f * ((3.0 * (p1 - p2)) + p3 - p0))))));
+    }
+}
+//------------------------------------------------------------------------
+std::pair<double, double> FunctionTable::getMaxError() const
+{
+    const std::vector<double> entries = getEntries();
+
+    // Evaluate table at a number of points within each interval
+    const unsigned int pointsPerInterval = 16;
+    const unsigned int numPoints = m_NumIntervals * pointsPerInterval;
+    double maxAbsError = 0.0;
+    double maxRelError = 0.0;
+    for(unsigned int p = 0; p < numPoints; p++) {
+        const double x = m_Min + ((m_Max - m_Min) * ((double)p + 0.5) / (double)numPoints);
+        const double exact = m_Function(x);
+        const double absError = std::fabs(interpolate(entries, x) - exact);
+
+        maxAbsError = std::max(maxAbsError, absError);
+        if(exact != 0.0) {
+            maxRelError = std::max(maxRelError, absError / std::fabs(exact));
+        }
+    }
+    return std::make_pair(maxAbsError, maxRelError);
+}
+//------------------------------------------------------------------------
+std::function<double(double)> FunctionTable::getMathsFunction(const std::string &functionName)
+{
+    static const std::map<std::string, double(*)(double)> mathsFunctions{
+        {"exp", [](double x){ return std::exp(x); }},
+        {"expm1", [](double x){ return std::expm1(x); }},
+        {"exp2", [](double x){ return std::exp2(x); }},
+        {"log", [](double x){ return std::log(x); }},
+        {"log1p", [](double x){ return std::log1p(x); }},
+        {"sqrt", [](double x){ return std::sqrt(x); }},
+        {"sin", [](double x){ return std::sin(x); }},
+        {"cos", [](double x){ return std::cos(x); }},
+        {"tan", [](double x){ return std::tan(x); }},
+        {"atan", [](double x){ return std::atan(x); }},
+        {"sinh", [](double x){ return std::sinh(x); }},
+        {"cosh", [](double x){ return std::cosh(x); }},
+        {"tanh", [](double x){ return std::tanh(x); }},
+        {"erf", [](double x){ return std::erf(x); }},
+        {"erfc", [](double x){ return std::erfc(x); }}};
+
+    const auto f = mathsFunctions.find(functionName);
+    if(f == mathsFunctions.cend()) {
+        return std::function<double(double)>();
+    }
+    else {
+        return f->second;
+    }
+}
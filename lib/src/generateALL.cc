@@ -35,14 +35,133 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include <iterator>
+#include <sstream>
 
 #ifdef _WIN32
 #include <direct.h>
 #else
 #include <sys/stat.h> // needed for mkdir
+#include <sys/wait.h>
+#include <dirent.h>
+#include <unistd.h>
 #endif
 
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+#ifndef _WIN32
+//! 64-bit FNV-1a hash used to identify compiled models in the build cache
+class BuildHash
+{
+public:
+    BuildHash() : m_Hash(14695981039346656037ull)
+    {
+    }
+
+    void update(const string &data)
+    {
+        for(const char c : data) {
+            m_Hash = (m_Hash ^ (unsigned char)c) * 1099511628211ull;
+        }
+
+        // Terminate each item so concatenations of different items don't collide
+        m_Hash = (m_Hash ^ 0xFF) * 1099511628211ull;
+    }
+
+    void updateFile(const string &filename)
+    {
+        ifstream is(filename.c_str(), ios::binary);
+        if(is.good()) {
+            ostringstream contents;
+            contents << is.rdbuf();
+            update(filename.substr(filename.find_last_of('/') + 1));
+            update(contents.str());
+        }
+    }
+
+    void updateDirectory(const string &path)
+    {
+        // Hash files in name order so the result doesn't depend on the order readdir returns them
+        DIR *dir = opendir(path.c_str());
+        if(dir != nullptr) {
+            vector<string> filenames;
+            while(const dirent *entry = readdir(dir)) {
+                filenames.push_back(entry->d_name);
+            }
+            closedir(dir);
+
+            sort(filenames.begin(), filenames.end());
+            for(const auto &f : filenames) {
+                updateFile(path + "/" + f);
+            }
+        }
+    }
+
+    void updateCommandOutput(const string &command)
+    {
+        FILE *pipe = popen(command.c_str(), "r");
+        if(pipe != nullptr) {
+            char buffer[256];
+            string output;
+            while(fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+                output += buffer;
+            }
+            pclose(pipe);
+            update(output);
+        }
+    }
+
+    string getHex() const
+    {
+        ostringstream os;
+        os << hex << setw(16) << setfill('0') << m_Hash;
+        return os.str();
+    }
+
+private:
+    unsigned long long m_Hash;
+};
+
+//! Run shell commands concurrently, exiting with an error if any of them fail
+void runCommandsParallel(const vector<string> &commands)
+{
+    vector<pid_t> children;
+    for(const auto &c : commands) {
+        cout << c << endl;
+        const pid_t pid = fork();
+        if(pid == 0) {
+            execl("/bin/sh", "sh", "-c", c.c_str(), (char*)nullptr);
+            _exit(127);
+        }
+        else if(pid < 0) {
+            gennError("build_model_runner: unable to start compiler");
+        }
+        children.push_back(pid);
+    }
+
+    // Wait for ALL commands to complete before reporting failure
+    bool failed = false;
+    for(pid_t pid : children) {
+        int status;
+        if(waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            failed = true;
+        }
+    }
+
+    if(failed) {
+        gennError("build_model_runner: compilation of generated code failed");
+    }
+}
+#endif  // !_WIN32
+}   // Anonymous namespace
+
 //--------------------------------------------------------------------------
 /*! \brief This function will call the necessary sub-functions to generate the code for simulating a model.
  */
@@ -112,6 +231,163 @@ void generate_model_runner(const NNmodel &model,    //!< Model description
 }
 
 
+//--------------------------------------------------------------------------
+/*! \brief This function generates the code for simulating a model, compiles it into a shared library and returns the path to the library.
+ */
+//--------------------------------------------------------------------------
+
+string build_model_runner(const NNmodel &model, //!< Model description
+                          const string &path,   //!< Path where the generated code will be deposited
+                          int localHostID)      //!< ID of local host
+{
+#ifdef _WIN32
+    gennError("build_model_runner: building models in-process is not supported on Windows - use genn-buildmodel.bat instead");
+    return "";
+#else
+    const char *gennPath = getenv("GENN_PATH");
+    if(gennPath == nullptr) {
+        gennError("build_model_runner: GENN_PATH environment variable is not set");
+    }
+    const string includePath = string(gennPath) + "/lib/include";
+    const string sparseUtilsPath = string(gennPath) + "/lib/src/sparseUtils.cc";
+
+    // Generated code must export its symbols with C linkage so they can be found once the library is loaded
+    // **NOTE** preference is restored afterwards so later calls to generate_model_runner aren't affected
+    const bool oldBuildSharedLibrary = GENN_PREFERENCES::buildSharedLibrary;
+    GENN_PREFERENCES::buildSharedLibrary = true;
+    generate_model_runner(model, path, localHostID);
+    GENN_PREFERENCES::buildSharedLibrary = oldBuildSharedLibrary;
+    const string codePath = model.getGeneratedCodePath(path, "");
+
+    // Profiles are recorded in the same location as the generated Makefile uses
+    // **NOTE** path is made absolute as instrumented libraries resolve it relative to the working directory of whichever process loads them
+    char *absoluteCodePath = realpath(codePath.c_str(), nullptr);
+    if(absoluteCodePath == nullptr) {
+        gennError("build_model_runner: unable to resolve generated code path '" + codePath + "'");
+    }
+    const string pgoPath = string(absoluteCodePath) + "/pgo";
+    free(absoluteCodePath);
+    const string &pgo = GENN_PREFERENCES::profileGuidedOptimisation;
+    if(!pgo.empty() && pgo != "generate" && pgo != "use") {
+        gennError("build_model_runner: unknown profile-guided optimisation mode '" + pgo + "' - should be 'generate', 'use' or empty");
+    }
+
+    // Build compiler flags, matching those used by the generated Makefile
+#ifdef CPU_ONLY
+    const char *cxx = getenv("CXX");
+    const string compiler = (cxx == nullptr) ? "c++" : cxx;
+
+    string flags = "-fPIC -DCPU_ONLY -std=c++11 -pthread";
+    flags += " " + GENN_PREFERENCES::userCxxFlagsGNU;
+    if (GENN_PREFERENCES::optimizeCode) {
+        flags += " -O3 -ffast-math";
+    }
+    if (GENN_PREFERENCES::debugCode) {
+        flags += " -O0 -g";
+    }
+    if (GENN_PREFERENCES::nativeCode) {
+        flags += " -march=native";
+    }
+    if (GENN_PREFERENCES::linkTimeOptimisation) {
+        flags += " -flto";
+    }
+    if (pgo == "generate") {
+        flags += " -fprofile-generate=\"" + pgoPath + "\"";
+    }
+    else if (pgo == "use") {
+        flags += " -fprofile-use=\"" + pgoPath + "\" -fprofile-correction";
+    }
+    const string compileFlags = "-c " + flags;
+    const string linkFlags = "-shared " + flags;
+#else
+    if(!pgo.empty()) {
+        gennError("build_model_runner: profile-guided optimisation is only supported for CPU_ONLY models");
+    }
+    const string compiler = "\"" NVCC "\"";
+
+    string flags = "-x cu -arch sm_";
+    flags += to_string(deviceProp[theDevice].major) + to_string(deviceProp[theDevice].minor);
+    flags += " -Xcompiler -fPIC -Xcompiler -pthread -std=c++11";
+    flags += " " + GENN_PREFERENCES::userNvccFlags;
+    if (GENN_PREFERENCES::optimizeCode) {
+        flags += " -O3 -use_fast_math";
+    }
+    if (GENN_PREFERENCES::debugCode) {
+        flags += " -O0 -g -G";
+    }
+    const string compileFlags = "-c " + flags;
+    const string linkFlags = "--shared -Xcompiler -fPIC -Xcompiler -pthread " + GENN_PREFERENCES::userNvccFlags;
+#endif
+    string includeFlags = "-I\"" + includePath + "\"";
+#ifdef MPI_ENABLE
+    includeFlags += " -I\"$MPI_PATH/include\"";
+#endif
+
+    // Hash everything that can affect the compiled library
+    BuildHash hash;
+    hash.update(compiler);
+    hash.update(compileFlags);
+    hash.update(linkFlags);
+    hash.updateCommandOutput(compiler + " --version 2>&1");
+    for(const char *f : {"definitions.h", "support_code.h", "runner.cc", "runnerGPU.cc", "init.cc",
+                         "mpi.cc", "neuronFnct.cc", "synapseFnct.cc", "neuronKrnl.cc", "synapseKrnl.cc"})
+    {
+        hash.updateFile(codePath + f);
+    }
+
+    // Include the GeNN headers and sources compiled into the library so cached libraries are rebuilt if GeNN changes
+    hash.updateDirectory(includePath);
+    hash.updateFile(sparseUtilsPath);
+
+    // When optimising with a recorded profile, rebuild whenever the profile changes
+    if(pgo == "use") {
+        hash.updateDirectory(pgoPath);
+    }
+
+    // If a library built from identical code is already in the cache, return it
+    const string cachePath = GENN_PREFERENCES::buildCacheDirectory.empty() ? codePath : (GENN_PREFERENCES::buildCacheDirectory + "/");
+    const string libraryPath = cachePath + "librunner_" + hash.getHex() + ".so";
+    if(access(libraryPath.c_str(), R_OK) == 0) {
+        cout << "using cached model library " << libraryPath << endl;
+        return libraryPath;
+    }
+
+    // Compile each translation unit concurrently
+    // **NOTE** on the CPU, init.cc doesn't use support code so can be compiled separately from runner.cc
+    vector<string> objects{codePath + "runner.o", codePath + "sparseUtils.o"};
+    vector<string> commands{
+#ifdef CPU_ONLY
+        compiler + " " + compileFlags + " -DSEPARATE_INIT_CC " + includeFlags + " \"" + codePath + "runner.cc\" -o \"" + objects[0] + "\"",
+#else
+        compiler + " " + compileFlags + " " + includeFlags + " \"" + codePath + "runner.cc\" -o \"" + objects[0] + "\"",
+#endif
+        compiler + " " + compileFlags + " " + includeFlags + " \"" + sparseUtilsPath + "\" -o \"" + objects[1] + "\""};
+#ifdef CPU_ONLY
+    objects.push_back(codePath + "init.o");
+    commands.push_back(compiler + " " + compileFlags + " " + includeFlags + " \"" + codePath + "init.cc\" -o \"" + objects[2] + "\"");
+#endif
+    runCommandsParallel(commands);
+
+    // Link into a temporary file and then rename so other processes sharing the cache never load a partial library
+    const string tempLibraryPath = libraryPath + "." + to_string(getpid());
+    string linkCommand = compiler + " " + linkFlags + " -o \"" + tempLibraryPath + "\"";
+    for(const auto &o : objects) {
+        linkCommand += " \"" + o + "\"";
+    }
+    runCommandsParallel({linkCommand});
+
+    if(rename(tempLibraryPath.c_str(), libraryPath.c_str()) != 0) {
+        gennError("build_model_runner: unable to move compiled model library into cache directory '" + cachePath + "'");
+    }
+    for(const auto &o : objects) {
+        remove(o.c_str());
+    }
+
+    return libraryPath;
+#endif  // _WIN32
+}
+
+
 //--------------------------------------------------------------------------
 /*!
   \brief Helper function that prepares data structures and detects the hardware properties to enable the code generation code that follows.
@@ -666,6 +942,14 @@ int main(int argc,     //!< number of arguments; expected to be 2
     GENN_PREFERENCES::debugCode = true;
 #endif // DEBUG
 
+#ifdef NATIVE_CODE
+    GENN_PREFERENCES::nativeCode = true;
+#endif // NATIVE_CODE
+
+#ifdef LINK_TIME_OPTIMISATION
+    GENN_PREFERENCES::linkTimeOptimisation = true;
+#endif // LINK_TIME_OPTIMISATION
+
 #ifndef CPU_ONLY
     CHECK_CUDA_ERRORS(cudaGetDeviceCount(&deviceCount));
     deviceProp = new cudaDeviceProp[deviceCount];
@@ -28,6 +28,9 @@
 #include "codeStream.h"
 
 #include <algorithm>
+#include <functional>
+#include <set>
+#include <sstream>
 #include <typeinfo>
 
 //-------------------------------------------------------------------------
@@ -35,6 +38,54 @@
 //-------------------------------------------------------------------------
 namespace
 {
+//-------------------------------------------------------------------------
+/*!
+  \brief Function for generating the code which adds a neuron to the active set of its population
+*/
+//-------------------------------------------------------------------------
+void genActiveSetAdd(CodeStream &os, const NeuronGroup &ng, const string &idx)
+{
+    os << "activeMask" << ng.getName() << "[(" << idx << ") / 32] |= (1u << ((" << idx << ") % 32));" << std::endl;
+}
+
+//-------------------------------------------------------------------------
+/*!
+  \brief Function for generating the code which adds a postsynaptic neuron to the active set of its
+  population after weight update \p code, if this is enabled and the code may have given it input
+*/
+//-------------------------------------------------------------------------
+void genActiveSetInput(CodeStream &os, const SynapseGroup &sg, const string &code, const string &postIdx)
+{
+    if(sg.getTrgNeuronGroup()->isActiveSetUpdateEnabled()
+        && (code.find("$(addToInSyn") != string::npos || code.find("$(inSyn)") != string::npos
+            || code.find("$(updatelinsyn)") != string::npos))
+    {
+        genActiveSetAdd(os, *sg.getTrgNeuronGroup(), postIdx);
+    }
+}
+
+//-------------------------------------------------------------------------
+/*!
+  \brief Function for generating the GENN_CTZ macro used to find the lowest set bit of a word
+*/
+//-------------------------------------------------------------------------
+void genCountTrailingZeros(CodeStream &os)
+{
+    os << "#ifndef GENN_CTZ" << std::endl;
+    os << "#ifdef __GNUC__" << std::endl;
+    os << "#define GENN_CTZ(X) __builtin_ctz(X)" << std::endl;
+    os << "#else" << std::endl;
+    os << "inline unsigned int gennCTZ(unsigned int x)" << std::endl;
+    os << "{" << std::endl;
+    os << "    unsigned int n = 0;" << std::endl;
+    os << "    while (!(x & 1)) { x >>= 1; n++; }" << std::endl;
+    os << "    return n;" << std::endl;
+    os << "}" << std::endl;
+    os << "#define GENN_CTZ(X) gennCTZ(X)" << std::endl;
+    os << "#endif" << std::endl;
+    os << "#endif" << std::endl << std::endl;
+}
+
 //-------------------------------------------------------------------------
 /*!
   \brief Function for generating the CUDA synapse kernel code that handles presynaptic
@@ -54,44 +105,145 @@ void generate_process_presynaptic_events_code_CPU(
     if ((evnt && sg.isSpikeEventRequired()) || (!evnt && sg.isTrueSpikeRequired())) {
         const auto *wu = sg.getWUModel();
 
+        const bool sparse = (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE);
+        const unsigned int numTrgNeurons = sg.getTrgNeuronGroup()->getNumNeurons();
+        const string spikeCount = "glbSpkCnt" + postfix + sg.getSrcNeuronGroup()->getName() + (sg.getSrcNeuronGroup()->isDelayRequired() ? "[preReadDelaySlot]" : "[0]");
+        const string queueOffset = sg.getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
+
+        // If spike propagation is split between threads, accumulate input into this thread's copy of inSyn (or the dendritic delay buffer)
+        const unsigned int numThreads = sg.getSpikePropagationThreads();
+        const string inSyn = (numThreads > 1) ? "inSynThread" : ("inSyn" + sg.getPSModelTargetName());
+        if (numThreads > 1) {
+            if (sg.isDendriticDelayRequired()) {
+                os << ftype << " *const denDelayThread = (propThread == 0) ? denDelay" << sg.getPSModelTargetName();
+                os << " : &denDelayPrivate" << sgName << "[(propThread - 1) * " << (size_t)numTrgNeurons * sg.getMaxDendriticDelayTimesteps() << "];" << std::endl;
+            }
+            else {
+                os << ftype << " *const inSynThread = (propThread == 0) ? inSyn" << sg.getPSModelTargetName();
+                os << " : &inSynPrivate" << sgName << "[(propThread - 1) * " << numTrgNeurons << "];" << std::endl;
+            }
+        }
+
+        // If cache blocking is enabled and the postsynaptic population is larger than a block, process
+        // all spikes against one block of postsynaptic neurons at a time so that part of inSyn stays in cache
+        const bool blocked = sg.isCacheBlocked();
+        if (blocked) {
+            os << "// process spikes against blocks of " << sg.getCacheBlockSize() << " postsynaptic neurons" << std::endl;
+            os << "for (unsigned int blockStart = 0; blockStart < " << numTrgNeurons << "; blockStart += " << sg.getCacheBlockSize() << ")" << CodeStream::OB(2050);
+            os << "const unsigned int blockEnd = (blockStart + " << sg.getCacheBlockSize() << " < " << numTrgNeurons << ") ? (blockStart + " << sg.getCacheBlockSize() << ") : " << numTrgNeurons << ";" << std::endl;
+        }
+
         // Detect spike events or spikes and do the update
         os << "// process presynaptic events: " << (evnt ? "Spike type events" : "True Spikes") << std::endl;
-        if (sg.getSrcNeuronGroup()->isDelayRequired()) {
-            os << "for (unsigned int i = 0; i < glbSpkCnt" << postfix << sg.getSrcNeuronGroup()->getName() << "[preReadDelaySlot]; i++)";
+        if (numThreads > 1) {
+            os << "const unsigned int spikeBegin = (unsigned int)(((unsigned long long)" << spikeCount << " * propThread) / " << numThreads << ");" << std::endl;
+            os << "const unsigned int spikeEnd = (unsigned int)(((unsigned long long)" << spikeCount << " * (propThread + 1)) / " << numThreads << ");" << std::endl;
+            os << "for (unsigned int i = spikeBegin; i < spikeEnd; i++)";
         }
         else {
-            os << "for (unsigned int i = 0; i < glbSpkCnt" << postfix << sg.getSrcNeuronGroup()->getName() << "[0]; i++)";
+            os << "for (unsigned int i = 0; i < " << spikeCount << "; i++)";
         }
         {
             CodeStream::Scope b(os);
 
-            const std::string queueOffset = sg.getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
             os << "const unsigned int ipre = glbSpk" << postfix << sg.getSrcNeuronGroup()->getName() << "[" << queueOffset << "i];" << std::endl;
 
-            if (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            // If cache blocking is enabled, prefetch the part of the row which will be processed for an upcoming spike
+            const bool individualVars = (sg.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) && !wu->getVars().empty();
+            if (sg.getCacheBlockSize() > 0 && (sparse || individualVars)) {
+                const unsigned int prefetchDistance = 4;
+                os << "if ((i + " << prefetchDistance << ") < " << spikeCount << ")";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const unsigned int iprePrefetch = glbSpk" << postfix << sg.getSrcNeuronGroup()->getName() << "[" << queueOffset << "i + " << prefetchDistance << "];" << std::endl;
+
+                    // Get index of first synapse in row to prefetch
+                    os << "const " << sg.getSynapseIndexType() << " synPrefetch = ";
+                    if (sg.getMatrixType() & SynapseMatrixConnectivity::YALE) {
+                        os << "C" << sgName << ".indInG[iprePrefetch]";
+                    }
+                    else if (sg.getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
+                        os << "(iprePrefetch * " << sg.getSynapseIndexStride(sg.getMaxConnections()) << ")";
+                    }
+                    else {
+                        os << "(iprePrefetch * " << sg.getSynapseIndexStride(numTrgNeurons) << ")";
+                    }
+                    if (blocked) {
+                        os << " + " << (sparse ? "((blockStart == 0) ? 0 : blockRowPos" + sgName + "[i + " + std::to_string(prefetchDistance) + "])" : "blockStart");
+                    }
+                    os << ";" << std::endl;
+
+                    if (sparse) {
+                        os << "GENN_PREFETCH(&C" << sgName << ".ind[synPrefetch]);" << std::endl;
+                    }
+                    if (individualVars) {
+                        for(const auto &v : wu->getVars()) {
+                            os << "GENN_PREFETCH(&" << v.first << sgName << "[synPrefetch]);" << std::endl;
+                        }
+                    }
+                }
+            }
+
+            if (sparse) {
                 if(sg.getMatrixType() & SynapseMatrixConnectivity::YALE) {
                     os << "const unsigned int npost = C" << sgName << ".indInG[ipre + 1] - C" << sgName << ".indInG[ipre];" << std::endl;
                 }
                 else {
                     os << "const unsigned int npost = C" << sgName << ".rowLength[ipre];" << std::endl;
                 }
-                os << "for (unsigned int j = 0; j < npost; j++)";
+
+                // If connectivity is delta-encoded, find this row's deltas and start from its first postsynaptic index
+                if (sg.isDeltaEncodingEnabled()) {
+                    os << "const uint32_t *deltaWords = &D" << sgName << ".words[D" << sgName << ".rowStart[ipre]];" << std::endl;
+                    os << "const unsigned int deltaWidth = D" << sgName << ".rowWidth[ipre];" << std::endl;
+                    os << "const uint64_t deltaMask = (1ull << deltaWidth) - 1;" << std::endl;
+                    os << "unsigned int deltaPost = D" << sgName << ".rowBase[ipre];" << std::endl;
+                }
+
+                // If blocking, continue from where the previous block reached in this row
+                if (blocked) {
+                    os << "unsigned int j = (blockStart == 0) ? 0 : blockRowPos" << sgName << "[i];" << std::endl;
+                    os << "for (; j < npost; j++)";
+                }
+                else {
+                    os << "for (unsigned int j = 0; j < npost; j++)";
+                }
             }
             // Otherwise (DENSE or BITMASK)
+            else if (blocked) {
+                os << "for (unsigned int ipost = blockStart; ipost < blockEnd; ipost++)";
+            }
             else {
-                os << "for (unsigned int ipost = 0; ipost < " << sg.getTrgNeuronGroup()->getNumNeurons() << "; ipost++)";
+                os << "for (unsigned int ipost = 0; ipost < " << numTrgNeurons << "; ipost++)";
             }
             {
                 CodeStream::Scope b(os);
                 if(sg.getMatrixType() & SynapseMatrixConnectivity::YALE) {
                     os << "const unsigned int ipost = C" << sgName << ".ind[C" << sgName << ".indInG[ipre] + j];" << std::endl;
                 }
+                else if(sg.isDeltaEncodingEnabled()) {
+                    // Extract delta from the 64-bit window containing its bits
+                    os << "const uint64_t deltaBit = (uint64_t)j * deltaWidth;" << std::endl;
+                    os << "const uint64_t deltaWindow = ((uint64_t)deltaWords[(deltaBit / 32) + 1] << 32) | deltaWords[deltaBit / 32];" << std::endl;
+                    os << "deltaPost += (unsigned int)((deltaWindow >> (deltaBit & 31)) & deltaMask);" << std::endl;
+                    os << "const unsigned int ipost = deltaPost;" << std::endl;
+                }
                 else if(sg.getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
                     // **TODO** seperate stride from max connections
-                    os << "const unsigned int ipost = C" << sgName << ".ind[(ipre * " << sg.getMaxConnections() << ") + j];" << std::endl;
+                    os << "const unsigned int ipost = C" << sgName << ".ind[(ipre * " << sg.getSynapseIndexStride(sg.getMaxConnections()) << ") + j];" << std::endl;
                 }
                 else if (sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                    os << "const uint64_t gid = (ipre * " << sg.getTrgNeuronGroup()->getNumNeurons() << "ull + ipost);" << std::endl;
+                    os << "const uint64_t gid = (ipre * " << numTrgNeurons << "ull + ipost);" << std::endl;
+                }
+
+                // If blocking, stop at first synapse beyond this block
+                // **NOTE** if rows aren't sorted, any synapses skipped are processed in the final block
+                if (sparse && blocked) {
+                    os << "if (ipost >= blockEnd)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "break;" << std::endl;
+                    }
                 }
 
                 if (!wu->getSimSupportCode().empty()) {
@@ -138,15 +290,20 @@ void generate_process_presynaptic_events_code_CPU(
                 string wCode = evnt ? wu->getEventCode() : wu->getSimCode();
 
                 if(sg.isDendriticDelayRequired()) {
-                    functionSubstitute(wCode, "addToInSynDelay", 2, "denDelay" + sg.getPSModelTargetName() + "[" + sg.getDendriticDelayOffset("", "$(1)") + "ipost] += $(0)");
+                    if (numThreads > 1) {
+                        functionSubstitute(wCode, "addToInSynDelay", 2, "denDelayThread[" + sg.getDendriticDelayOffset("", "$(1)") + "ipost] += $(0)");
+                    }
+                    else {
+                        functionSubstitute(wCode, "addToInSynDelay", 2, sg.getDendriticDelayAddCode("ipost"));
+                    }
                 }
                 else {
-                    functionSubstitute(wCode, "addToInSyn", 1, "inSyn" + sg.getPSModelTargetName() + "[ipost] += $(0)");
+                    functionSubstitute(wCode, "addToInSyn", 1, inSyn + "[ipost] += $(0)");
 
                     // **DEPRECATED**
                     os << ftype << " addtoinSyn;" << std::endl;
                     substitute(wCode, "$(updatelinsyn)", "$(inSyn) += $(addtoinSyn)");
-                    substitute(wCode, "$(inSyn)", "inSyn" + sg.getPSModelTargetName() + "[ipost]");
+                    substitute(wCode, "$(inSyn)", inSyn + "[ipost]");
                 }
 
                 substitute(wCode, "$(t)", "t");
@@ -158,11 +315,11 @@ void generate_process_presynaptic_events_code_CPU(
                     else if(sg.getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
                         // **TODO** seperate stride from max connections
                         name_substitutions(wCode, "", wuVars.nameBegin, wuVars.nameEnd,
-                                           sgName + "[(ipre * " + to_string(sg.getMaxConnections()) + ") + j]");
+                                           sgName + "[(ipre * " + sg.getSynapseIndexStride(sg.getMaxConnections()) + ") + j]");
                     }
                     else {
                         name_substitutions(wCode, "", wuVars.nameBegin, wuVars.nameEnd,
-                                           sgName + "[ipre * " + to_string(sg.getTrgNeuronGroup()->getNumNeurons()) + " + ipost]");
+                                           sgName + "[ipre * " + sg.getSynapseIndexStride(sg.getTrgNeuronGroup()->getNumNeurons()) + " + ipost]");
                     }
                 }
 
@@ -172,6 +329,7 @@ void generate_process_presynaptic_events_code_CPU(
                                                        "ipre", "ipost", "", cpuFunctions, ftype, dt);
                 // end Code substitutions -------------------------------------------------------------------------
                 os << wCode << std::endl;
+                genActiveSetInput(os, sg, evnt ? wu->getEventCode() : wu->getSimCode(), "ipost");
 
                 if (evnt) {
                     os << CodeStream::CB(2041); // end if (eCode)
@@ -180,9 +338,268 @@ void generate_process_presynaptic_events_code_CPU(
                     os << CodeStream::CB(2041); // end if (B(gp" << sgName << "[gid / 32], gid
                 }
             }
+
+            // If blocking, record where the next block should continue from in this row
+            if (sparse && blocked) {
+                os << "blockRowPos" << sgName << "[i] = j;" << std::endl;
+            }
+        }
+
+        if (blocked) {
+            os << CodeStream::CB(2050);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+/*!
+  \brief Function that returns the delay queue slot of a neuron group written \p delaySteps timesteps
+  before the current one, once the host spike queue pointers have been advanced for the neuron update
+*/
+//-------------------------------------------------------------------------
+string getAdvancedQueueSlot(const NeuronGroup &ng, unsigned int delaySteps)
+{
+    const unsigned int numDelaySlots = ng.getNumDelaySlots();
+    return "((spkQuePtr" + ng.getName() + " + " + to_string(numDelaySlots - delaySteps - 1) + ") % " + to_string(numDelaySlots) + ")";
+}
+
+//-------------------------------------------------------------------------
+/*!
+  \brief Function for generating the code which adds a new version of a spiking neuron's entries in its
+  versioned queues, carrying forward the values of any variables which won't be written by its spike code
+
+  The oldest version is overwritten. Reads are never more than numDelaySlots - 1 timesteps old and
+  neurons can spike at most once a timestep, so that version is never needed.
+*/
+//-------------------------------------------------------------------------
+void genAdvanceVersionedQueue(CodeStream &os, const NeuronGroup &ng)
+{
+    const string name = ng.getName();
+    os << "versionHead" << name << "[n] = (versionHead" << name << "[n] + 1) % " << ng.getNumDelaySlots() << ";" << std::endl;
+    os << "const unsigned int versionWriteOffset = versionHead" << name << "[n] * " << ng.getNumNeurons() << ";" << std::endl;
+    os << "versionStep" << name << "[versionWriteOffset + n] = iT;" << std::endl;
+
+    // **NOTE** spike time is always written by the spike code
+    for(const auto *sg : ng.getOutSyn()) {
+        if(sg->getDelaySteps() != NO_DELAY && sg->getWUModel()->getPreSpikeCode().empty()) {
+            for(const auto &v : sg->getWUModel()->getPreVars()) {
+                os << v.first << sg->getName() << "[versionWriteOffset + n] = " << v.first << sg->getName() << "[versionReadOffset + n];" << std::endl;
+            }
+        }
+    }
+    for(const auto *sg : ng.getInSyn()) {
+        if(sg->getBackPropDelaySteps() != NO_DELAY && sg->getWUModel()->getPostSpikeCode().empty()) {
+            for(const auto &v : sg->getWUModel()->getPostVars()) {
+                os << v.first << sg->getName() << "[versionWriteOffset + n] = " << v.first << sg->getName() << "[versionReadOffset + n];" << std::endl;
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+/*!
+  \brief Function for generating the function which finds the offset of the most recent version of a neuron's
+  entries in a versioned queue which was written at or before a given timestep
+*/
+//-------------------------------------------------------------------------
+void genVersionedQueueOffsetFunction(CodeStream &os, const NeuronGroup &ng)
+{
+    const string name = ng.getName();
+    os << "inline unsigned int versionedQueueOffset" << name << "(unsigned int n, long long step)";
+    {
+        CodeStream::Scope b(os);
+        os << "unsigned int slot = versionHead" << name << "[n];" << std::endl;
+        os << "while (versionStep" << name << "[(slot * " << ng.getNumNeurons() << ") + n] > step)";
+        {
+            CodeStream::Scope b(os);
+            os << "slot = (slot + " << (ng.getNumDelaySlots() - 1) << ") % " << ng.getNumDelaySlots() << ";" << std::endl;
+        }
+        os << "return slot * " << ng.getNumNeurons() << ";" << std::endl;
+    }
+    os << std::endl;
+}
+
+//-------------------------------------------------------------------------
+/*!
+  \brief Function for generating the code which asks the kernel to start reading the rows of an
+  out-of-core synapse group belonging to presynaptic neurons which have spiked from disk
+
+  Spikes are emitted in order of neuron index so rows are then processed in order of their file offset.
+*/
+//-------------------------------------------------------------------------
+void generate_prefetch_presynaptic_rows_CPU(
+    CodeStream &os, //!< output stream for code
+    const string &sgName,
+    const SynapseGroup &sg,
+    const string &postfix) //!< whether to generate code for true spikes or spike type events
+{
+    const NeuronGroup *srcNG = sg.getSrcNeuronGroup();
+
+    os << "// prefetch rows of presynaptic neurons with " << ((postfix == "Evnt") ? "spike type events" : "true spikes") << std::endl;
+    if (srcNG->isDelayRequired()) {
+        os << "for (unsigned int i = 0; i < glbSpkCnt" << postfix << srcNG->getName() << "[preReadDelaySlot]; i++)";
+    }
+    else {
+        os << "for (unsigned int i = 0; i < glbSpkCnt" << postfix << srcNG->getName() << "[0]; i++)";
+    }
+    {
+        CodeStream::Scope b(os);
+
+        const string queueOffset = srcNG->isDelayRequired() ? "preReadDelayOffset + " : "";
+        os << "const unsigned int ipre = glbSpk" << postfix << srcNG->getName() << "[" << queueOffset << "i];" << std::endl;
+        if (sg.getMatrixType() & SynapseMatrixConnectivity::YALE) {
+            os << "const size_t rowStart = C" << sgName << ".indInG[ipre];" << std::endl;
+            os << "const size_t rowLength = C" << sgName << ".indInG[ipre + 1] - rowStart;" << std::endl;
+        }
+        else {
+            os << "const size_t rowStart = (size_t)ipre * " << sg.getMaxConnections() << ";" << std::endl;
+            os << "const size_t rowLength = C" << sgName << ".rowLength[ipre];" << std::endl;
+        }
+
+        os << "FileBackedArray::prefetch(C" << sgName << ".ind, rowStart, rowLength);" << std::endl;
+        if (sg.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+            for(const auto &v : sg.getWUModel()->getVars()) {
+                os << "FileBackedArray::prefetch(" << v.first << sgName << ", rowStart, rowLength);" << std::endl;
+            }
         }
     }
 }
+
+//-------------------------------------------------------------------------
+/*!
+  \brief Function for generating the code which adds the rows of presynaptic neurons whose
+  spikes are being delivered to the active row list of an activity-gated synapse group
+*/
+//-------------------------------------------------------------------------
+void generate_synapse_dynamics_row_activation_CPU(
+    CodeStream &os, //!< output stream for code
+    const string &sgName,
+    const SynapseGroup &sg)
+{
+    const NeuronGroup *srcNG = sg.getSrcNeuronGroup();
+    const string rowActiveStep = "rowActiveStep" + sgName;
+
+    os << "// activate rows of presynaptic neurons which have spiked" << std::endl;
+    if (srcNG->isDelayRequired()) {
+        os << "for (unsigned int spk = 0; spk < glbSpkCnt" << srcNG->getName() << "[preReadDelaySlot]; spk++)";
+    }
+    else {
+        os << "for (unsigned int spk = 0; spk < glbSpkCnt" << srcNG->getName() << "[0]; spk++)";
+    }
+    {
+        CodeStream::Scope b(os);
+
+        const string queueOffset = srcNG->isDelayRequired() ? "preReadDelayOffset + " : "";
+        os << "const unsigned int ipre = glbSpk" << srcNG->getName() << "[" << queueOffset << "spk];" << std::endl;
+        os << "if (" << rowActiveStep << "[ipre] == ~0ull)";
+        {
+            CodeStream::Scope b(os);
+            os << "activeRows" << sgName << "[activeRowCount" << sgName << "++] = ipre;" << std::endl;
+        }
+        os << rowActiveStep << "[ipre] = iT;" << std::endl;
+    }
+}
+
+//-------------------------------------------------------------------------
+/*!
+  \brief Function for generating the loop over presynaptic rows in which synapse dynamics are applied
+
+  If the synapse group's dynamics are gated by presynaptic activity, only rows in the active row list
+  are visited. Rows are retired from the list once their neuron has not spiked for the activity window.
+*/
+//-------------------------------------------------------------------------
+void generate_synapse_dynamics_row_loop_CPU(
+    CodeStream &os, //!< output stream for code
+    const string &sgName,
+    const SynapseGroup &sg,
+    std::function<void()> rowHandler) //!< function to generate code for processing row i
+{
+    if (sg.isSynapseDynamicsActivityGated()) {
+        const string activeRows = "activeRows" + sgName;
+        const string activeRowCount = "activeRowCount" + sgName;
+        const string rowActiveStep = "rowActiveStep" + sgName;
+
+        os << "// loop through active rows" << std::endl;
+        os << "for (unsigned int r = 0; r < " << activeRowCount << ";)";
+        {
+            CodeStream::Scope b(os);
+            os << "const unsigned int i = " << activeRows << "[r];" << std::endl;
+
+            // If neuron hasn't spiked within activity window, replace row with last active row and re-test
+            os << "if ((iT - " << rowActiveStep << "[i]) >= " << sg.getSynapseDynamicsActivityWindow() << "ull)";
+            {
+                CodeStream::Scope b(os);
+                os << rowActiveStep << "[i] = ~0ull;" << std::endl;
+                os << activeRows << "[r] = " << activeRows << "[--" << activeRowCount << "];" << std::endl;
+                os << "continue;" << std::endl;
+            }
+            os << "r++;" << std::endl;
+
+            rowHandler();
+        }
+    }
+    else {
+        os << "for (int i = 0; i < " <<  sg.getSrcNeuronGroup()->getNumNeurons() << "; i++)";
+        {
+            CodeStream::Scope b(os);
+            rowHandler();
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+/*!
+  \brief Function that returns the identifiers whose values can't change during a call to calcNeuronsCPU or calcSynapsesCPU
+*/
+//-------------------------------------------------------------------------
+std::set<std::string> getInvariantIdentifiers(const NNmodel &model)
+{
+    std::set<std::string> invariantIdentifiers{"t", "DT"};
+
+    // Scalar extra global parameters are only changed by user code between timesteps
+    auto addExtraGlobalParams =
+        [&invariantIdentifiers](const NewModels::Base::StringPairVec &extraGlobalParams, const std::string &suffix)
+        {
+            for(const auto &e : extraGlobalParams) {
+                if(e.second.find('*') == std::string::npos) {
+                    invariantIdentifiers.insert(e.first + suffix);
+                }
+            }
+        };
+
+    // As are parameters flagged as dynamic
+    auto addDynamicParams =
+        [&invariantIdentifiers](const std::vector<std::pair<std::string, double>> &dynamicParamValues)
+        {
+            for(const auto &p : dynamicParamValues) {
+                invariantIdentifiers.insert(p.first);
+            }
+        };
+
+    for(const auto &n : model.getLocalNeuronGroups()) {
+        addExtraGlobalParams(n.second.getNeuronModel()->getExtraGlobalParams(), n.first);
+        addDynamicParams(n.second.getDynamicParamValues());
+    }
+    for(const auto &c : model.getLocalCurrentSources()) {
+        addExtraGlobalParams(c.second.getCurrentSourceModel()->getExtraGlobalParams(), c.first);
+    }
+    for(const auto &s : model.getLocalSynapseGroups()) {
+        addExtraGlobalParams(s.second.getWUModel()->getExtraGlobalParams(), s.first);
+        addDynamicParams(s.second.getDynamicParamValues());
+    }
+    return invariantIdentifiers;
+}
+
+//-------------------------------------------------------------------------
+/*!
+  \brief Function that writes code to os, preceded by constants holding any invariant maths expressions hoisted out of it
+*/
+//-------------------------------------------------------------------------
+void writeHoistedCode(CodeStream &os, std::string code, const std::set<std::string> &invariantIdentifiers)
+{
+    os << hoistInvariantExpressions(code, invariantIdentifiers, "_hoisted");
+    os << code;
+}
 }   // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -222,13 +639,47 @@ void genNeuronFunction(const NNmodel &model, //!< Model description
     os << "// include the support codes provided by the user for neuron or synaptic models" << std::endl;
     os << "#include \"support_code.h\"" << std::endl << std::endl;
 
+    // If any neuron groups only update their active neurons, define macro to find the next one
+    if (std::any_of(model.getLocalNeuronGroups().cbegin(), model.getLocalNeuronGroups().cend(),
+                    [](const NNmodel::NeuronGroupValueType &n){ return n.second.isActiveSetUpdateEnabled(); }))
+    {
+        genCountTrailingZeros(os);
+    }
+
+    // Maths expressions involving only these are hoisted out of the loops over neurons
+    const auto invariantIdentifiers = getInvariantIdentifiers(model);
+
+    // If phase overlap is required, update the neuron groups which don't depend on the overlapped synapse groups first
+    const bool phaseOverlap = model.isPhaseOverlapRequired();
+    std::vector<const NNmodel::NeuronGroupValueType*> neuronGroups;
+    for(const auto &n : model.getLocalNeuronGroups()) {
+        if(!phaseOverlap || !model.isNeuronGroupOverlapBlocked(n.second)) {
+            neuronGroups.push_back(&n);
+        }
+    }
+    const size_t numUnblockedNeuronGroups = neuronGroups.size();
+    for(const auto &n : model.getLocalNeuronGroups()) {
+        if(phaseOverlap && model.isNeuronGroupOverlapBlocked(n.second)) {
+            neuronGroups.push_back(&n);
+        }
+    }
+
     // function header
     os << "void calcNeuronsCPU(" << model.getTimePrecision() << " t)";
     {
         CodeStream::Scope b(os);
 
         // function code
-        for(const auto &n : model.getLocalNeuronGroups()) {
+        for(size_t i = 0; i < neuronGroups.size(); i++) {
+            const auto &n = *neuronGroups[i];
+
+            // Once the unblocked neuron groups have been updated, wait for the overlapped synapse groups
+            if(phaseOverlap && i == numUnblockedNeuronGroups) {
+                os << "// wait for spike propagation through overlapped synapse groups to complete" << std::endl;
+                os << "overlapWorker->wait();" << std::endl;
+                os << std::endl;
+            }
+
             os << "// neuron group " << n.first << std::endl;
             {
                 CodeStream::Scope b(os);
@@ -246,18 +697,82 @@ void genNeuronFunction(const NNmodel &model, //!< Model description
                 }
                 os << std::endl;
 
-                os << "for (int n = 0; n < " <<  n.second.getNumNeurons() << "; n++)";
+                // Move input arriving from sparse dendritic delay queues this timestep into inSyn
+                // **NOTE** this is done before the update interval check so input is accumulated until the next update
+                for(const auto &m : n.second.getMergedInSyn()) {
+                    const auto *sg = m.first;
+                    if(sg->isDendriticDelayRequired() && sg->isSparseDendriticDelayEnabled()) {
+                        CodeStream::Scope b(os);
+                        os << "auto &denDelayFront" << sg->getPSModelTargetName() << " = denDelayQueue" << sg->getPSModelTargetName() << "[denDelayPtr" << sg->getPSModelTargetName() << "];" << std::endl;
+                        os << "for (const auto &d : denDelayFront" << sg->getPSModelTargetName() << ")";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "inSyn" << sg->getPSModelTargetName() << "[d.first] += d.second;" << std::endl;
+                            if (n.second.isActiveSetUpdateEnabled()) {
+                                genActiveSetAdd(os, n.second, "d.first");
+                            }
+                        }
+                        os << "denDelayFront" << sg->getPSModelTargetName() << ".clear();" << std::endl;
+                    }
+                }
+
+                // If group is only updated every few timesteps, skip the timesteps in between
+                // **NOTE** spike counts are still reset above so spikes emitted at the last update are only delivered once
+                if (n.second.getUpdateInterval() > 1) {
+                    os << "if ((iT % " << n.second.getUpdateInterval() << ") == 0)" << CodeStream::OB(300);
+                }
+
+                // Get neuron model associated with this group
+                auto nm = n.second.getNeuronModel();
+
+                // If active-set updates are enabled, current sources are applied to every neuron and
+                // any neuron they inject current into is added to the active set, so it is updated below
+                const bool activeSet = n.second.isActiveSetUpdateEnabled();
+                if (activeSet && !n.second.getCurrentSources().empty()) {
+                    os << "for (int n = 0; n < " <<  n.second.getNumNeurons() << "; n++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << model.getPrecision() << " Isyn = 0;" << std::endl;
+                        StandardGeneratedSections::neuronCurrentInjection(os, n.second,
+                                   "", "n", cpuFunctions, model.getPrecision(), "rng");
+                        os << "if (Isyn != " << model.scalarExpr(0.0) << ")";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "csInput" << n.first << "[n] = Isyn;" << std::endl;
+                            genActiveSetAdd(os, n.second, "n");
+                        }
+                    }
+                }
+
+                // Generate loop into a separate stream so invariant expressions can be hoisted out of it
+                std::ostringstream loopStream;
                 {
-                    CodeStream::Scope b(os);
+                    CodeStream os(loopStream);
 
-                    // Get neuron model associated with this group
-                    auto nm = n.second.getNeuronModel();
+                    // If active-set updates are enabled, only loop through the neurons whose bits are set in the active
+                    // set, a word at a time, so neurons which are at rest and receiving no input are never loaded
+                    if (activeSet) {
+                        os << "for (unsigned int w = 0; w < " << (n.second.getNumNeurons() + 31) / 32 << "; w++)";
+                    }
+                    else {
+                        os << "for (int n = 0; n < " <<  n.second.getNumNeurons() << "; n++)";
+                    }
+                    CodeStream::Scope b(os);
+                    if (activeSet) {
+                        os << "for (unsigned int m = activeMask" << n.first << "[w]; m != 0; m &= (m - 1))" << CodeStream::OB(311);
+                        os << "const int n = (int)((w * 32) + GENN_CTZ(m));" << std::endl;
+                    }
 
                     // Create iteration context to iterate over the variables; derived and extra global parameters
                     VarNameIterCtx nmVars(nm->getVars());
                     DerivedParamNameIterCtx nmDerivedParams(nm->getDerivedParams());
                     ExtraGlobalParamNameIterCtx nmExtraGlobalParams(nm->getExtraGlobalParams());
 
+                    // If spike triggered variables are versioned, READ from the most recent version of this neuron's entries
+                    if (n.second.isVersionedDelayQueueRequired()) {
+                        os << "const unsigned int versionReadOffset = versionHead" << n.first << "[n] * " << n.second.getNumNeurons() << ";" << std::endl;
+                    }
+
                     // Generate code to copy neuron state into local variable
                     StandardGeneratedSections::neuronLocalVarInit(os, n.second, nmVars, "", "n", model.getTimePrecision());
 
@@ -274,8 +789,8 @@ void genNeuronFunction(const NNmodel &model, //!< Model description
                         const auto *sg = m.first;
                         const auto *psm = sg->getPSModel();
 
-                        // If dendritic delay is required
-                        if(sg->isDendriticDelayRequired()) {
+                        // If dense dendritic delay buffer is required
+                        if(sg->isDendriticDelayRequired() && !sg->isSparseDendriticDelayEnabled()) {
                             // Get reference to dendritic delay buffer input for this timestep
                             os << model.getPrecision() << " &denDelayFront" << sg->getPSModelTargetName() << " = denDelay" + sg->getPSModelTargetName() + "[" + sg->getDendriticDelayOffset("") + "n];" << std::endl;
 
@@ -329,8 +844,14 @@ void genNeuronFunction(const NNmodel &model, //!< Model description
                     }
 
                     // check for current sources and insert code if necessary
-                    StandardGeneratedSections::neuronCurrentInjection(os, n.second,
-                               "", "n", cpuFunctions, model.getPrecision(), "rng");
+                    if (activeSet && !n.second.getCurrentSources().empty()) {
+                        os << "Isyn += csInput" << n.first << "[n];" << std::endl;
+                        os << "csInput" << n.first << "[n] = " << model.scalarExpr(0.0) << ";" << std::endl;
+                    }
+                    else {
+                        StandardGeneratedSections::neuronCurrentInjection(os, n.second,
+                                   "", "n", cpuFunctions, model.getPrecision(), "rng");
+                    }
 
                     os << "// calculate membrane potential" << std::endl;
                     string sCode = nm->getSimCode();
@@ -386,6 +907,10 @@ void genNeuronFunction(const NNmodel &model, //!< Model description
                                 os << "[0]++] = n;" << std::endl;
                             }
 
+                            // If spike triggered variables are versioned, add a new version of this neuron's entries
+                            if (n.second.isVersionedDelayQueueRequired()) {
+                                genAdvanceVersionedQueue(os, n.second);
+                            }
 
                             // Insert code to update any weight update model presynaptic variables associated with outgoing connections
                             StandardGeneratedSections::weightUpdatePreSpike(os, n.second, "", "n",
@@ -397,7 +922,7 @@ void genNeuronFunction(const NNmodel &model, //!< Model description
 
                             // Reset spike time
                             if (n.second.isSpikeTimeRequired()) {
-                                os << "sT" << n.first << "[" << queueOffset << "n] = t;" << std::endl;
+                                os << "sT" << n.first << "[" << (n.second.isVersionedDelayQueueRequired() ? "versionWriteOffset + " : queueOffset) << "n] = " << (n.second.isCompactSpikeTimesEnabled() ? "iT" : "t") << ";" << std::endl;
                             }
 
                             // add after-spike reset if provided
@@ -441,10 +966,84 @@ void genNeuronFunction(const NNmodel &model, //!< Model description
                             os << v.first << sg->getPSModelTargetName() << "[n]" << " = lps" << v.first << sg->getPSModelTargetName() << ";" << std::endl;
                         }
                     }
+
+                    // If neuron is now at rest and has no pending input, remove it from the active set
+                    if (activeSet) {
+                        if (!nm->getSupportCode().empty()) {
+                            os << " using namespace " << n.first << "_neuron;" << std::endl;
+                        }
+
+                        string rCode = nm->getRestConditionCode();
+                        substitute(rCode, "$(id)", "n");
+                        StandardSubstitutions::neuronRestCondition(rCode, n.second,
+                                                                   nmVars, nmDerivedParams, nmExtraGlobalParams,
+                                                                   cpuFunctions, model.getPrecision());
+
+                        os << "// leave active set if at rest and no input is pending" << std::endl;
+                        os << "bool atRest = (" << rCode << ")";
+                        for(const auto &m : n.second.getMergedInSyn()) {
+                            os << " && (inSyn" << m.first->getPSModelTargetName() << "[n] == " << model.scalarExpr(0.0) << ")";
+                        }
+                        os << ";" << std::endl;
+
+                        // **NOTE** input may have been added to any slot of a dense dendritic delay buffer
+                        for(const auto &m : n.second.getMergedInSyn()) {
+                            const auto *sg = m.first;
+                            if(sg->isDendriticDelayRequired() && !sg->isSparseDendriticDelayEnabled()) {
+                                os << "for (unsigned int d = 0; atRest && d < " << sg->getMaxDendriticDelayTimesteps() << "; d++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "atRest = (denDelay" << sg->getPSModelTargetName() << "[(d * " << n.second.getNumNeurons() << ") + n] == " << model.scalarExpr(0.0) << ");" << std::endl;
+                                }
+                            }
+                        }
+                        os << "if (atRest)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "activeMask" << n.first << "[w] &= ~(1u << (n % 32));" << std::endl;
+                        }
+                        os << CodeStream::CB(311);
+                    }
+                }
+                writeHoistedCode(os, loopStream.str(), invariantIdentifiers);
+
+                if (n.second.getUpdateInterval() > 1) {
+                    os << CodeStream::CB(300);
+
+                    // On skipped timesteps, dendritic delay buffers still need to be moved into inSyn
+                    // before the slot is reused so that their input is accumulated until the next update
+                    const auto &mergedInSyn = n.second.getMergedInSyn();
+                    if (std::any_of(mergedInSyn.cbegin(), mergedInSyn.cend(),
+                                    [](const std::pair<SynapseGroup*, std::vector<SynapseGroup*>> &m)
+                                    {
+                                        return m.first->isDendriticDelayRequired() && !m.first->isSparseDendriticDelayEnabled();
+                                    }))
+                    {
+                        os << "else" << CodeStream::OB(301);
+                        os << "for (int n = 0; n < " <<  n.second.getNumNeurons() << "; n++)";
+                        {
+                            CodeStream::Scope b(os);
+                            for(const auto &m : mergedInSyn) {
+                                const auto *sg = m.first;
+                                if(sg->isDendriticDelayRequired() && !sg->isSparseDendriticDelayEnabled()) {
+                                    os << model.getPrecision() << " &denDelayFront" << sg->getPSModelTargetName() << " = denDelay" + sg->getPSModelTargetName() + "[" + sg->getDendriticDelayOffset("") + "n];" << std::endl;
+                                    os << "inSyn" + sg->getPSModelTargetName() + "[n] += denDelayFront" << sg->getPSModelTargetName() << ";" << std::endl;
+                                    os << "denDelayFront" << sg->getPSModelTargetName() << " = " << model.scalarExpr(0.0) << ";" << std::endl;
+                                }
+                            }
+                        }
+                        os << CodeStream::CB(301);
+                    }
                 }
             }
             os << std::endl;
         }
+
+        // If every neuron group could be updated while the overlapped synapse groups were running, wait for them here
+        if(phaseOverlap && numUnblockedNeuronGroups == neuronGroups.size()) {
+            os << "// wait for spike propagation through overlapped synapse groups to complete" << std::endl;
+            os << "overlapWorker->wait();" << std::endl;
+        }
     }
     os << "#endif" << std::endl;
     fs.close();
@@ -483,6 +1082,31 @@ void genSynapseFunction(const NNmodel &model, //!< Model description
     os << "*/" << std::endl;
     os << "//-------------------------------------------------------------------------" << std::endl << std::endl;
 
+    // Define functions to look up delayed entries in versioned queues
+    for(const auto &n : model.getLocalNeuronGroups()) {
+        if(n.second.isVersionedDelayQueueRequired()) {
+            genVersionedQueueOffsetFunction(os, n.second);
+        }
+    }
+
+    // If any synapse groups are cache-blocked, define macro to prefetch upcoming rows
+    if (std::any_of(model.getLocalSynapseGroups().cbegin(), model.getLocalSynapseGroups().cend(),
+                    [](const std::pair<const std::string, SynapseGroup> &s){ return (s.second.getCacheBlockSize() > 0); }))
+    {
+        os << "#ifdef __GNUC__" << std::endl;
+        os << "#define GENN_PREFETCH(ADDRESS) __builtin_prefetch(ADDRESS)" << std::endl;
+        os << "#else" << std::endl;
+        os << "#define GENN_PREFETCH(ADDRESS)" << std::endl;
+        os << "#endif" << std::endl << std::endl;
+    }
+
+    // If any synapse groups only apply synapse dynamics to the synapses in a bitmask, define macro to find the next set bit
+    if (std::any_of(model.getLocalSynapseGroups().cbegin(), model.getLocalSynapseGroups().cend(),
+                    [](const std::pair<const std::string, SynapseGroup> &s){ return s.second.isSynapseDynamicsSkipMaskEnabled(); }))
+    {
+        genCountTrailingZeros(os);
+    }
+
     if (!model.getSynapseDynamicsGroups().empty()) {
         // synapse dynamics function
         os << "void calcSynapseDynamicsCPU(" << model.getTimePrecision() << " t)";
@@ -506,7 +1130,8 @@ void genSynapseFunction(const NNmodel &model, //!< Model description
 
                         // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
                         if(sg->getSrcNeuronGroup()->isDelayRequired()) {
-                            os << "const unsigned int preReadDelayOffset = " << sg->getPresynapticAxonalDelaySlot("") << " * " << sg->getSrcNeuronGroup()->getNumNeurons() << ";" << std::endl;
+                            os << "const unsigned int preReadDelaySlot = " << sg->getPresynapticAxonalDelaySlot("") << ";" << std::endl;
+                            os << "const unsigned int preReadDelayOffset = preReadDelaySlot * " << sg->getSrcNeuronGroup()->getNumNeurons() << ";" << std::endl;
                         }
 
                         // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
@@ -514,6 +1139,16 @@ void genSynapseFunction(const NNmodel &model, //!< Model description
                             os << "const unsigned int postReadDelayOffset = " << sg->getPostsynapticBackPropDelaySlot("") << " * " << sg->getTrgNeuronGroup()->getNumNeurons() << ";" << std::endl;
                         }
 
+                        // If dynamics are gated by presynaptic activity, activate rows every timestep so no spikes are missed
+                        if (sg->isSynapseDynamicsActivityGated()) {
+                            generate_synapse_dynamics_row_activation_CPU(os, s.first, *sg);
+                        }
+
+                        // If dynamics are only applied every few timesteps, skip the timesteps in between
+                        if (sg->getSynapseDynamicsUpdateInterval() > 1) {
+                            os << "if ((iT % " << sg->getSynapseDynamicsUpdateInterval() << ") == 0)" << CodeStream::OB(310);
+                        }
+
                         if (!wu->getSynapseDynamicsSuppportCode().empty()) {
                             os << "using namespace " << s.first << "_weightupdate_synapseDynamics;" << std::endl;
                         }
@@ -529,52 +1164,19 @@ void genSynapseFunction(const NNmodel &model, //!< Model description
                         substitute(SDcode, "$(t)", "t");
 
                         if (sg->getMatrixType() & SynapseMatrixConnectivity::YALE) {
-                            os << "for (int n= 0; n < C" << s.first << ".connN; n++)";
-                            {
-                                CodeStream::Scope b(os);
-                                if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-                                    // name substitute synapse var names in synapseDynamics code
-                                    name_substitutions(SDcode, "", wuVars.nameBegin, wuVars.nameEnd, s.first + "[n]");
-                                }
-
-                                const std::string postIdx = "C" + s.first + ".ind[n]";
-                                if(sg->isDendriticDelayRequired()) {
-                                    functionSubstitute(SDcode, "addToInSynDelay", 2, "denDelay" + sg->getPSModelTargetName() + "[" + sg->getDendriticDelayOffset("", "$(1)") + postIdx + "] += $(0)");
-                                }
-                                else {
-                                    functionSubstitute(SDcode, "addToInSyn", 1, "inSyn" + sg->getPSModelTargetName() + "[" + postIdx + "] += $(0)");
-
-                                    // **DEPRECATED**
-                                    substitute(SDcode, "$(updatelinsyn)", "$(inSyn) += $(addtoinSyn)");
-                                    substitute(SDcode, "$(inSyn)", "inSyn" + sg->getPSModelTargetName() + "[" + postIdx + "]");
-                                }
-
-                                StandardSubstitutions::weightUpdateDynamics(SDcode, sg, wuVars, wuPreVars, wuPostVars, wuDerivedParams, wuExtraGlobalParams,
-                                                                            "C" + s.first + ".preInd[n]", postIdx, "",
-                                                                            cpuFunctions, model.getPrecision(), model.getDT());
-                                os << SDcode << std::endl;
-                            }
-                        }
-                        else if(sg->getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
-                            os << "for (int i = 0; i < " <<  sg->getSrcNeuronGroup()->getNumNeurons() << "; i++)";
-                            {
-                                CodeStream::Scope b(os);
-                                os << "for (int j = 0; j < C" << s.first << ".rowLength[i]; j++)";
+                            // Lambda to generate code for processing synapse n with presynaptic index preIdx
+                            auto genSynapse =
+                                [&os, &SDcode, &s, sg, &model, &wuVars, &wuPreVars, &wuPostVars, &wuDerivedParams, &wuExtraGlobalParams]
+                                (const std::string &preIdx)
                                 {
-                                    CodeStream::Scope b(os);
-
-                                    // Calculate index of synapse in arrays
-                                    os << "const int n = (i * " + std::to_string(sg->getMaxConnections()) + ") + j;" << std::endl;
-
                                     if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
                                         // name substitute synapse var names in synapseDynamics code
-                                        // **TODO** seperate stride from max connections
                                         name_substitutions(SDcode, "", wuVars.nameBegin, wuVars.nameEnd, s.first + "[n]");
                                     }
 
                                     const std::string postIdx = "C" + s.first + ".ind[n]";
                                     if(sg->isDendriticDelayRequired()) {
-                                        functionSubstitute(SDcode, "addToInSynDelay", 2, "denDelay" + sg->getPSModelTargetName() + "[" + sg->getDendriticDelayOffset("", "$(1)") + postIdx + "] += $(0)");
+                                        functionSubstitute(SDcode, "addToInSynDelay", 2, sg->getDendriticDelayAddCode(postIdx));
                                     }
                                     else {
                                         functionSubstitute(SDcode, "addToInSyn", 1, "inSyn" + sg->getPSModelTargetName() + "[" + postIdx + "] += $(0)");
@@ -585,27 +1187,105 @@ void genSynapseFunction(const NNmodel &model, //!< Model description
                                     }
 
                                     StandardSubstitutions::weightUpdateDynamics(SDcode, sg, wuVars, wuPreVars, wuPostVars, wuDerivedParams, wuExtraGlobalParams,
-                                                                                "i", postIdx, "", cpuFunctions, model.getPrecision(), model.getDT());
+                                                                                preIdx, postIdx, "",
+                                                                                cpuFunctions, model.getPrecision(), model.getDT());
                                     os << SDcode << std::endl;
+                                    genActiveSetInput(os, *sg, sg->getWUModel()->getSynapseDynamicsCode(), postIdx);
+                                };
+
+                            // If dynamics are gated by presynaptic activity, loop through the synapses in each active row
+                            if (sg->isSynapseDynamicsActivityGated()) {
+                                generate_synapse_dynamics_row_loop_CPU(os, s.first, *sg,
+                                    [&os, &s, &genSynapse]()
+                                    {
+                                        os << "for (unsigned int n = C" << s.first << ".indInG[i]; n < C" << s.first << ".indInG[i + 1]; n++)";
+                                        {
+                                            CodeStream::Scope b(os);
+                                            genSynapse("i");
+                                        }
+                                    });
+                            }
+                            // Otherwise, loop through all synapses
+                            else {
+                                os << "for (int n= 0; n < C" << s.first << ".connN; n++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    genSynapse("C" + s.first + ".preInd[n]");
                                 }
                             }
                         }
+                        else if(sg->getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
+                            generate_synapse_dynamics_row_loop_CPU(os, s.first, *sg,
+                                [&os, &SDcode, &s, sg, &model, &wuVars, &wuPreVars, &wuPostVars, &wuDerivedParams, &wuExtraGlobalParams]()
+                                {
+                                    os << "for (int j = 0; j < C" << s.first << ".rowLength[i]; j++)";
+                                    {
+                                        CodeStream::Scope b(os);
+
+                                        // Calculate index of synapse in arrays
+                                        os << "const " << sg->getSynapseIndexType() << " n = (i * " << sg->getSynapseIndexStride(sg->getMaxConnections()) << ") + j;" << std::endl;
+
+                                        if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+                                            // name substitute synapse var names in synapseDynamics code
+                                            // **TODO** seperate stride from max connections
+                                            name_substitutions(SDcode, "", wuVars.nameBegin, wuVars.nameEnd, s.first + "[n]");
+                                        }
+
+                                        const std::string postIdx = "C" + s.first + ".ind[n]";
+                                        if(sg->isDendriticDelayRequired()) {
+                                            functionSubstitute(SDcode, "addToInSynDelay", 2, sg->getDendriticDelayAddCode(postIdx));
+                                        }
+                                        else {
+                                            functionSubstitute(SDcode, "addToInSyn", 1, "inSyn" + sg->getPSModelTargetName() + "[" + postIdx + "] += $(0)");
+
+                                            // **DEPRECATED**
+                                            substitute(SDcode, "$(updatelinsyn)", "$(inSyn) += $(addtoinSyn)");
+                                            substitute(SDcode, "$(inSyn)", "inSyn" + sg->getPSModelTargetName() + "[" + postIdx + "]");
+                                        }
+
+                                        StandardSubstitutions::weightUpdateDynamics(SDcode, sg, wuVars, wuPreVars, wuPostVars, wuDerivedParams, wuExtraGlobalParams,
+                                                                                    "i", postIdx, "", cpuFunctions, model.getPrecision(), model.getDT());
+                                        os << SDcode << std::endl;
+                                        genActiveSetInput(os, *sg, sg->getWUModel()->getSynapseDynamicsCode(), postIdx);
+                                    }
+                                });
+                        }
                         else {
-                            os << "for (int i = 0; i < " <<  sg->getSrcNeuronGroup()->getNumNeurons() << "; i++)";
-                            {
-                                CodeStream::Scope b(os);
-                                os << "for (int j = 0; j < " <<  sg->getTrgNeuronGroup()->getNumNeurons() << "; j++)";
+                            generate_synapse_dynamics_row_loop_CPU(os, s.first, *sg,
+                                [&os, &SDcode, &s, sg, &model, &wuVars, &wuPreVars, &wuPostVars, &wuDerivedParams, &wuExtraGlobalParams]()
                                 {
-                                    CodeStream::Scope b(os);
-                                    os << "// loop through all synapses" << endl;
-                                    // substitute initial values as constants for synapse var names in synapseDynamics code
+                                    const unsigned int numPost = sg->getTrgNeuronGroup()->getNumNeurons();
+
+                                    // Hoist pointers to this row of each variable out of the loop over synapses so it only indexes them with j
                                     if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-                                        name_substitutions(SDcode, "", wuVars.nameBegin, wuVars.nameEnd,
-                                                           s.first + "[(i * " + to_string(sg->getTrgNeuronGroup()->getNumNeurons()) + ") + j]");
+                                        for(const auto &v : sg->getWUModel()->getVars()) {
+                                            if(SDcode.find("$(" + v.first + ")") != std::string::npos) {
+                                                os << sg->getWUVarStorageTypeName(v.first) << " *const " << v.first << "Row" << s.first << " = &" << v.first << s.first;
+                                                os << "[i * " << sg->getSynapseIndexStride(numPost) << "];" << std::endl;
+                                            }
+                                        }
+
+                                        // name substitute synapse var names in synapseDynamics code
+                                        name_substitutions(SDcode, "", wuVars.nameBegin, wuVars.nameEnd, "Row" + s.first + "[j]");
+                                    }
+
+                                    // If synapses are skipped, loop through set bits of each word of row's mask
+                                    if (sg->isSynapseDynamicsSkipMaskEnabled()) {
+                                        const unsigned int rowWords = (numPost + 31) / 32;
+                                        os << "const unsigned int *synDynMaskRow = &synDynMask" << s.first << "[i * " << rowWords << "];" << std::endl;
+                                        os << "for (unsigned int w = 0; w < " << rowWords << "; w++)";
+                                        os << CodeStream::OB(320);
+                                        os << "for (unsigned int m = synDynMaskRow[w]; m != 0; m &= (m - 1))";
+                                        os << CodeStream::OB(321);
+                                        os << "const unsigned int j = (w * 32) + GENN_CTZ(m);" << std::endl;
+                                    }
+                                    else {
+                                        os << "for (int j = 0; j < " << numPost << "; j++)";
+                                        os << CodeStream::OB(320);
                                     }
 
                                     if(sg->isDendriticDelayRequired()) {
-                                        functionSubstitute(SDcode, "addToInSynDelay", 2, "denDelay" + sg->getPSModelTargetName() + "[" + sg->getDendriticDelayOffset("", "$(1)") + "j] += $(0)");
+                                        functionSubstitute(SDcode, "addToInSynDelay", 2, sg->getDendriticDelayAddCode("j"));
                                     }
                                     else {
                                         functionSubstitute(SDcode, "addToInSyn", 1, "inSyn" + sg->getPSModelTargetName() + "[j] += $(0)");
@@ -618,8 +1298,17 @@ void genSynapseFunction(const NNmodel &model, //!< Model description
                                     StandardSubstitutions::weightUpdateDynamics(SDcode, sg, wuVars, wuPreVars, wuPostVars, wuDerivedParams, wuExtraGlobalParams,
                                                                                 "i","j", "", cpuFunctions, model.getPrecision(), model.getDT());
                                     os << SDcode << std::endl;
-                                }
-                            }
+                                    genActiveSetInput(os, *sg, sg->getWUModel()->getSynapseDynamicsCode(), "j");
+
+                                    if (sg->isSynapseDynamicsSkipMaskEnabled()) {
+                                        os << CodeStream::CB(321);
+                                    }
+                                    os << CodeStream::CB(320);
+                                });
+                        }
+
+                        if (sg->getSynapseDynamicsUpdateInterval() > 1) {
+                            os << CodeStream::CB(310);
                         }
                     }
                 }
@@ -627,43 +1316,182 @@ void genSynapseFunction(const NNmodel &model, //!< Model description
         }
     }
 
-    // synapse function header
-    os << "void calcSynapsesCPU(" << model.getTimePrecision() << " t)";
-    {
-        CodeStream::Scope b(os);
-        os << std::endl;
+    // Maths expressions involving only these are hoisted out of the loops over spikes
+    const auto invariantIdentifiers = getInvariantIdentifiers(model);
 
-        for(const auto &s : model.getLocalSynapseGroups()) {
+    // Generates the code to propagate spikes through a synapse group
+    // **NOTE** overlapped synapse groups are run after the host spike queue pointers have been advanced
+    auto genSynapseGroup =
+        [&model, &invariantIdentifiers](CodeStream &os, const NNmodel::SynapseGroupValueType &s, bool overlapped)
+        {
             os << "// synapse group " << s.first << std::endl;
             {
                 CodeStream::Scope b(os);
 
                 // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
-                if(s.second.getSrcNeuronGroup()->isDelayRequired()) {
-                    os << "const unsigned int preReadDelaySlot = " << s.second.getPresynapticAxonalDelaySlot("") << ";" << std::endl;
-                    os << "const unsigned int preReadDelayOffset = preReadDelaySlot * " << s.second.getSrcNeuronGroup()->getNumNeurons() << ";" << std::endl;
+                const NeuronGroup *srcNG = s.second.getSrcNeuronGroup();
+                if(srcNG->isDelayRequired()) {
+                    os << "const unsigned int preReadDelaySlot = ";
+                    if(overlapped) {
+                        os << getAdvancedQueueSlot(*srcNG, s.second.getDelaySteps());
+                    }
+                    else {
+                        os << s.second.getPresynapticAxonalDelaySlot("");
+                    }
+                    os << ";" << std::endl;
+                    os << "const unsigned int preReadDelayOffset = preReadDelaySlot * " << srcNG->getNumNeurons() << ";" << std::endl;
                 }
 
                 // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
-                if(s.second.getTrgNeuronGroup()->isDelayRequired()) {
-                    os << "const unsigned int postReadDelayOffset = " << s.second.getPostsynapticBackPropDelaySlot("") << " * " << s.second.getTrgNeuronGroup()->getNumNeurons() << ";" << std::endl;
+                const NeuronGroup *trgNG = s.second.getTrgNeuronGroup();
+                if(trgNG->isDelayRequired()) {
+                    os << "const unsigned int postReadDelayOffset = ";
+                    if(overlapped) {
+                        os << getAdvancedQueueSlot(*trgNG, s.second.getBackPropDelaySteps());
+                    }
+                    else {
+                        os << s.second.getPostsynapticBackPropDelaySlot("");
+                    }
+                    os << " * " << trgNG->getNumNeurons() << ";" << std::endl;
+                }
+
+                // If synapse group is stored out-of-core, start reading all the rows which will be processed this timestep
+                if(s.second.isOutOfCore()) {
+                    if (s.second.isSpikeEventRequired()) {
+                        generate_prefetch_presynaptic_rows_CPU(os, s.first, s.second, "Evnt");
+                    }
+                    if (s.second.isTrueSpikeRequired()) {
+                        generate_prefetch_presynaptic_rows_CPU(os, s.first, s.second, "");
+                    }
                 }
 
-                // generate the code for processing spike-like events
-                if (s.second.isSpikeEventRequired()) {
-                    generate_process_presynaptic_events_code_CPU(os, s.first, s.second, "Evnt", model.getPrecision(), model.getDT());
+                // Generate event processing into a separate stream so invariant expressions can be hoisted out of it
+                std::ostringstream eventStream;
+                {
+                    CodeStream os(eventStream);
+
+                    // generate the code for processing spike-like events
+                    if (s.second.isSpikeEventRequired()) {
+                        generate_process_presynaptic_events_code_CPU(os, s.first, s.second, "Evnt", model.getPrecision(), model.getDT());
+                    }
+
+                    // generate the code for processing true spike events
+                    if (s.second.isTrueSpikeRequired()) {
+                        generate_process_presynaptic_events_code_CPU(os, s.first, s.second, "", model.getPrecision(), model.getDT());
+                    }
                 }
+                writeHoistedCode(os, eventStream.str(), invariantIdentifiers);
+            }
+            os << std::endl;
+        };
+
+    // If spike propagation through any synapse groups is split between threads, generate functions to propagate
+    // one thread's share of their spikes and then to add one thread's share of their private input buffers into the shared ones
+    for(const auto &s : model.getLocalSynapseGroups()) {
+        const unsigned int numThreads = s.second.getSpikePropagationThreads();
+        if(numThreads > 1) {
+            os << "void propagateSpikes" << s.first << "(" << model.getTimePrecision() << " t, unsigned int propThread)";
+            {
+                CodeStream::Scope b(os);
+                genSynapseGroup(os, s, model.isSynapseGroupOverlapped(s.second));
+            }
+            os << std::endl;
 
-                // generate the code for processing true spike events
-                if (s.second.isTrueSpikeRequired()) {
-                    generate_process_presynaptic_events_code_CPU(os, s.first, s.second, "", model.getPrecision(), model.getDT());
+            // **NOTE** the inner loops are over contiguous postsynaptic neurons so can be vectorised
+            const std::string &target = s.second.getPSModelTargetName();
+            os << "void reduceInSyn" << s.first << "(unsigned int propThread)";
+            {
+                CodeStream::Scope b(os);
+                auto genReduce =
+                    [&os, &model, numThreads](const std::string &shared, const std::string &copies, size_t size)
+                    {
+                        os << "const unsigned int " << shared << "Begin = (unsigned int)((" << size << "ull * propThread) / " << numThreads << ");" << std::endl;
+                        os << "const unsigned int " << shared << "End = (unsigned int)((" << size << "ull * (propThread + 1)) / " << numThreads << ");" << std::endl;
+                        os << "for (unsigned int c = 0; c < " << numThreads - 1 << "; c++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "for (unsigned int j = " << shared << "Begin; j < " << shared << "End; j++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << shared << "[j] += " << copies << "[(c * " << size << ") + j];" << std::endl;
+                                os << copies << "[(c * " << size << ") + j] = " << model.scalarExpr(0.0) << ";" << std::endl;
+                            }
+                        }
+                    };
+
+                const size_t numTrgNeurons = s.second.getTrgNeuronGroup()->getNumNeurons();
+                if(s.second.isDendriticDelayRequired()) {
+                    genReduce("denDelay" + target, "denDelayPrivate" + s.first, numTrgNeurons * s.second.getMaxDendriticDelayTimesteps());
+                }
+                else {
+                    genReduce("inSyn" + target, "inSynPrivate" + s.first, numTrgNeurons);
                 }
             }
             os << std::endl;
         }
     }
+
+    // Generates the code to propagate spikes through a synapse group, splitting them between
+    // the simulation thread and the propagation worker threads if this is required
+    auto genSynapseGroupCall =
+        [&genSynapseGroup](CodeStream &os, const NNmodel::SynapseGroupValueType &s, bool overlapped)
+        {
+            const unsigned int numThreads = s.second.getSpikePropagationThreads();
+            if(numThreads > 1) {
+                os << "// synapse group " << s.first << " on " << numThreads << " threads" << std::endl;
+                for(const std::string func : {"propagateSpikes", "reduceInSyn"}) {
+                    CodeStream::Scope b(os);
+                    const std::string args = (func == "propagateSpikes") ? "t, " : "";
+                    os << "for (unsigned int w = 0; w < " << numThreads - 1 << "; w++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "propagationWorkers[w]->start([" << args << "w](){ " << func << s.first << "(" << args << "w + 1); });" << std::endl;
+                    }
+                    os << func << s.first << "(" << args << "0);" << std::endl;
+                    os << "for (unsigned int w = 0; w < " << numThreads - 1 << "; w++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "propagationWorkers[w]->wait();" << std::endl;
+                    }
+                }
+                os << std::endl;
+            }
+            else {
+                genSynapseGroup(os, s, overlapped);
+            }
+        };
+
+    // synapse function header
+    os << "void calcSynapsesCPU(" << model.getTimePrecision() << " t)";
+    {
+        CodeStream::Scope b(os);
+        os << std::endl;
+
+        for(const auto &s : model.getLocalSynapseGroups()) {
+            if(!model.isSynapseGroupOverlapped(s.second)) {
+                genSynapseGroupCall(os, s, false);
+            }
+        }
+    }
     os << std::endl;
 
+    // If phase overlap is required, generate a separate function to propagate spikes
+    // through overlapped synapse groups on the worker thread during the neuron update
+    if(model.isPhaseOverlapRequired()) {
+        os << "void calcOverlappedSynapsesCPU(" << model.getTimePrecision() << " t)";
+        {
+            CodeStream::Scope b(os);
+            os << std::endl;
+
+            for(const auto &s : model.getLocalSynapseGroups()) {
+                if(model.isSynapseGroupOverlapped(s.second)) {
+                    genSynapseGroupCall(os, s, true);
+                }
+            }
+        }
+        os << std::endl;
+    }
+
 
     //////////////////////////////////////////////////////////////
     // function for learning synapses, post-synaptic spikes
@@ -755,7 +1583,7 @@ void genSynapseFunction(const NNmodel &model, //!< Model description
                                     os << "ipre = C" << s.first << ".revIndInG[lSpk] + l;" << std::endl;
                                 }
                                 else {
-                                    os << "ipre = (lSpk * " << sg->getMaxSourceConnections() << ") + l;" << std::endl;
+                                    os << "const " << sg->getSynapseIndexType() << " colMajorIndex = (lSpk * " << sg->getSynapseIndexStride(sg->getMaxSourceConnections()) << ") + l;" << std::endl;
                                 }
                             }
 
@@ -764,18 +1592,20 @@ void genSynapseFunction(const NNmodel &model, //!< Model description
                             // Code substitutions ----------------------------------------------------------------------------------
                             std::string preIndex;
                             if (sparse) {
-                                name_substitutions(code, "", wuVars.nameBegin, wuVars.nameEnd,
-                                                   s.first + "[C" + s.first + ".remap[ipre]]");
                                 if(sg->getMatrixType() & SynapseMatrixConnectivity::YALE) {
+                                    name_substitutions(code, "", wuVars.nameBegin, wuVars.nameEnd,
+                                                       s.first + "[C" + s.first + ".remap[ipre]]");
                                     preIndex = "C" + s.first + ".revInd[ipre]";
                                 }
                                 else {
-                                    preIndex = "(C" + s.first + ".remap[ipre] / " + to_string(sg->getMaxConnections()) + ")";
+                                    name_substitutions(code, "", wuVars.nameBegin, wuVars.nameEnd,
+                                                       s.first + "[C" + s.first + ".remap[colMajorIndex]]");
+                                    preIndex = "(C" + s.first + ".remap[colMajorIndex] / " + to_string(sg->getMaxConnections()) + ")";
                                 }
                             }
                             else { // DENSE
                                 name_substitutions(code, "", wuVars.nameBegin, wuVars.nameEnd,
-                                                s.first + "[lSpk + " + to_string(sg->getTrgNeuronGroup()->getNumNeurons()) + " * ipre]");
+                                                s.first + "[lSpk + " + sg->getSynapseIndexStride(sg->getTrgNeuronGroup()->getNumNeurons()) + " * ipre]");
                                 
                                 preIndex = "ipre";
                             }
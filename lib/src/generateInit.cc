@@ -497,7 +497,7 @@ unsigned int genInitializeDeviceKernel(CodeStream &os, const NNmodel &model, int
                     }
 
                     // Loop through rows of matrix
-                    os << "unsigned int idx = lid;" << std::endl;
+                    os << s.second.getSynapseIndexType() << " idx = lid;" << std::endl;
                     os << "for(unsigned int i = 0; i < " << s.second.getSrcNeuronGroup()->getNumNeurons() << "; i++)";
                     {
                         CodeStream::Scope b(os);
@@ -570,7 +570,7 @@ unsigned int genInitializeDeviceKernel(CodeStream &os, const NNmodel &model, int
                         os << rowLength << " = 0;" << std::endl;
 
                         // Build function template to increment row length and insert synapse into ind array
-                        const std::string addSynapseTemplate = ind + "[(lid * " + std::to_string(s.second.getMaxConnections()) + ") + (" + rowLength + "++)] = $(0)";
+                        const std::string addSynapseTemplate = ind + "[(lid * " + s.second.getSynapseIndexStride(s.second.getMaxConnections()) + ") + (" + rowLength + "++)] = $(0)";
 
                         /// Initialise row building state variables and loop on generated code to initialise sparse connectivity
                         os << "// Build sparse connectivity" << std::endl;
@@ -612,8 +612,15 @@ unsigned int genInitializeSparseDeviceKernel(unsigned int numStaticInitThreads,
 
         // Shared memory array so row lengths don't have to be read by EVERY postsynaptic thread
         // **TODO** check actually required
+        // **NOTE** row starts are cumulative synapse counts so need to be 64-bit if any group's synapse indices are
+        const bool synapseIndex64Bit = std::any_of(model.getLocalSynapseGroups().cbegin(), model.getLocalSynapseGroups().cend(),
+                                                   [](const NNmodel::SynapseGroupValueType &s)
+                                                   {
+                                                       return (s.second.isDeviceSparseInitRequired() && s.second.isSynapseIndex64BitRequired());
+                                                   });
+        const std::string rowStartType = synapseIndex64Bit ? "uint64_t" : "unsigned int";
         os << "__shared__ unsigned int shRowLength[" << initSparseBlkSz << "];" << std::endl;
-        os << "__shared__ unsigned int shRowStart[" << initSparseBlkSz + 1 << "];" << std::endl;
+        os << "__shared__ " << rowStartType << " shRowStart[" << initSparseBlkSz + 1 << "];" << std::endl;
 
         // common variables for all cases
         os << "const unsigned int id = " << initSparseBlkSz << " * blockIdx.x + threadIdx.x;" << std::endl;
@@ -656,7 +663,7 @@ unsigned int genInitializeSparseDeviceKernel(unsigned int numStaticInitThreads,
                     }
 
                     if(s.second.getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
-                        os << "unsigned int idx = lid;" << std::endl;
+                        os << s.second.getSynapseIndexType() << " idx = lid;" << std::endl;
                     }
 
                     // Calculate how many blocks rows need to be processed in (in order to store row lengths in shared memory)
@@ -699,7 +706,7 @@ unsigned int genInitializeSparseDeviceKernel(unsigned int numStaticInitThreads,
 
                                 // Get index of last row in resultant synapse dynamics structure
                                 // **NOTE** if there IS a previous block, it will always have had initSparseBlkSz rows in it
-                                os << "unsigned int rowStart = (r == 0) ? 0 : shRowStart[" << initSparseBlkSz << "];" << std::endl;
+                                os << rowStartType << " rowStart = (r == 0) ? 0 : shRowStart[" << initSparseBlkSz << "];" << std::endl;
                                 os << "shRowStart[0] = rowStart;" << std::endl;
 
                                 // Loop through rows in block
@@ -765,7 +772,7 @@ unsigned int genInitializeSparseDeviceKernel(unsigned int numStaticInitThreads,
                                         os << "const unsigned int colLocation = atomicAdd(&dd_colLength" << s.first << "[postIndex], 1);" << std::endl;
 
                                         // From this calculate index into column-major matrix
-                                        os << "const unsigned int colMajorIndex = (postIndex * " << s.second.getMaxSourceConnections() << ") + colLocation;" << std::endl;
+                                        os << "const " << s.second.getSynapseIndexType() << " colMajorIndex = (postIndex * " << s.second.getSynapseIndexStride(s.second.getMaxSourceConnections()) << ") + colLocation;" << std::endl;
 
                                         // Add remapping entry at this location poining back to row-major index
                                         os << "dd_remap" << s.first << "[colMajorIndex] = idx;" << std::endl;
@@ -813,6 +820,15 @@ void genInit(const NNmodel &model,      //!< Model description
     writeHeader(os);
     os << std::endl;
 
+#ifdef CPU_ONLY
+    // Include everything required to compile init.cc separately from runner.cc
+    os << "#include \"definitions.h\"" << std::endl;
+    os << "#include <cstdlib>" << std::endl;
+    os << "#include <cstdio>" << std::endl;
+    os << "#include <ctime>" << std::endl;
+    os << std::endl;
+#endif  // CPU_ONLY
+
 #ifndef CPU_ONLY
     // If device RNG is required, generate kernel to initialise it
     if(model.isDeviceRNGRequired()) {
@@ -969,7 +985,42 @@ void genInit(const NNmodel &model,      //!< Model description
                 os << "for (int i = 0; i < " << n.second.getNumNeurons() * n.second.getNumDelaySlots() << "; i++)";
                 {
                     CodeStream::Scope b(os);
-                    os << "sT" <<  n.first << "[i] = -TIME_MAX;" << std::endl;
+                    os << "sT" <<  n.first << "[i] = " << (n.second.isCompactSpikeTimesEnabled() ? "INT32_MIN" : "-TIME_MAX") << ";" << std::endl;
+                }
+            }
+
+            // Point versioned queues at their first entries, which hold the initial values and predate any delayed read
+            if (n.second.isVersionedDelayQueueRequired()) {
+                CodeStream::Scope b(os);
+                os << "for (int i = 0; i < " << n.second.getNumNeurons() << "; i++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "versionHead" << n.first << "[i] = 0;" << std::endl;
+                }
+                os << "for (int i = 0; i < " << n.second.getNumNeurons() * n.second.getNumDelaySlots() << "; i++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "versionStep" << n.first << "[i] = -" << n.second.getNumDelaySlots() + 1 << "ll;" << std::endl;
+                }
+            }
+
+            // Start with every neuron in the active set as their initial state may not be at rest
+            if (n.second.isActiveSetUpdateEnabled()) {
+                CodeStream::Scope b(os);
+                os << "for (int i = 0; i < " << (n.second.getNumNeurons() + 31) / 32 << "; i++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "activeMask" << n.first << "[i] = 0xFFFFFFFFu;" << std::endl;
+                }
+                if ((n.second.getNumNeurons() % 32) != 0) {
+                    os << "activeMask" << n.first << "[" << n.second.getNumNeurons() / 32 << "] = (1u << " << n.second.getNumNeurons() % 32 << ") - 1u;" << std::endl;
+                }
+                if (!n.second.getCurrentSources().empty()) {
+                    os << "for (int i = 0; i < " << n.second.getNumNeurons() << "; i++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "csInput" << n.first << "[i] = " << model.scalarExpr(0.0) << ";" << std::endl;
+                    }
                 }
             }
 
@@ -1023,8 +1074,17 @@ void genInit(const NNmodel &model,      //!< Model description
                     os << ", sizeof(unsigned int), 0, cudaMemcpyHostToDevice));" << std::endl;
 #endif
 
-                    // If dendritic delay buffer should be initialised on the host
-                    if(shouldInitOnHost(sg->getDendriticDelayVarMode())) {
+                    // If dendritic delay is sparse, empty queues
+                    if(sg->isSparseDendriticDelayEnabled()) {
+                        CodeStream::Scope b(os);
+                        os << "for (int i = 0; i < " << sg->getMaxDendriticDelayTimesteps() << "; i++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "denDelayQueue" << sg->getPSModelTargetName() << "[i].clear();" << std::endl;
+                        }
+                    }
+                    // Otherwise, if dendritic delay buffer should be initialised on the host
+                    else if(shouldInitOnHost(sg->getDendriticDelayVarMode())) {
                         CodeStream::Scope b(os);
                         os << "for (int i = 0; i < " << n.second.getNumNeurons() * sg->getMaxDendriticDelayTimesteps() << "; i++)";
                         {
@@ -1064,6 +1124,29 @@ void genInit(const NNmodel &model,      //!< Model description
                                      [&s](size_t i){ return s.second.getWUPostVarMode(i); },
                                      [&s](size_t){ return (s.second.getBackPropDelaySteps() != NO_DELAY); });
 
+            // If synapse dynamics are gated by presynaptic activity, empty active row list
+            if(s.second.isSynapseDynamicsActivityGated()) {
+                CodeStream::Scope b(os);
+                os << "activeRowCount" << s.first << " = 0;" << std::endl;
+                os << "for (int i = 0; i < " << numSrcNeurons << "; i++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "rowActiveStep" << s.first << "[i] = ~0ull;" << std::endl;
+                }
+            }
+
+            // If spike propagation is split between threads, zero private copies of input buffer
+            if(s.second.getSpikePropagationThreads() > 1) {
+                const bool denDelay = s.second.isDendriticDelayRequired();
+                const size_t numCopies = s.second.getSpikePropagationThreads() - 1;
+                CodeStream::Scope b(os);
+                os << "for (int i = 0; i < " << numCopies * numTrgNeurons * (denDelay ? s.second.getMaxDendriticDelayTimesteps() : 1) << "; i++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << (denDelay ? "denDelayPrivate" : "inSynPrivate") << s.first << "[i] = " << model.scalarExpr(0.0) << ";" << std::endl;
+                }
+            }
+
             // If we should initialise this synapse group's connectivity on the
             // host and it has a connectivity initialisation snippet
             const auto &connectInit = s.second.getConnectivityInitialiser();
@@ -1072,6 +1155,11 @@ void genInit(const NNmodel &model,      //!< Model description
             {
                 CodeStream::Scope b(os);
 
+                // Initialise any row building state variables shared between rows
+                for(const auto &a : connectInit.getSnippet()->getSharedRowBuildStateVars()) {
+                    os << a.second.first << " " << a.first << " = " << a.second.second << ";" << std::endl;
+                }
+
                 // If matrix connectivity is ragged
                 if(s.second.getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
                     const std::string rowLength = "C" + s.first + ".rowLength";
@@ -1086,7 +1174,7 @@ void genInit(const NNmodel &model,      //!< Model description
                         CodeStream::Scope b(os);
 
                         // Build function template to increment row length and insert synapse into ind array
-                        const std::string addSynapseTemplate = ind + "[(i * " + std::to_string(s.second.getMaxConnections()) + ") + (" + rowLength + "[i]++)] = $(0)";
+                        const std::string addSynapseTemplate = ind + "[(i * " + s.second.getSynapseIndexStride(s.second.getMaxConnections()) + ") + (" + rowLength + "[i]++)] = $(0)";
 
                         // Initialise row building state variables and loop on generated code to initialise sparse connectivity
                         os << "// Build sparse connectivity" << std::endl;
@@ -1167,7 +1255,7 @@ void genInit(const NNmodel &model,      //!< Model description
                             os << "for (int j = 0; j < " << numTrgNeurons << "; j++)";
                             {
                                 CodeStream::Scope b(os);
-                                const std::string idx = "(i * " + std::to_string(numTrgNeurons) + ") + j";
+                                const std::string idx = "(i * " + s.second.getSynapseIndexStride(numTrgNeurons) + ") + j";
                                 os << StandardSubstitutions::initWeightUpdateVariable(varInit, wuVars[k].first + s.first + "[" + idx + "]",
                                                                                       cpuFunctions, "i", "j", model.getPrecision(), "rng") << std::endl;
                             }
@@ -1274,7 +1362,7 @@ void genInit(const NNmodel &model,      //!< Model description
                     // Get number of per-synapse variables to copy (as a string)
                     const std::string count = (s.second.getMatrixType() & SynapseMatrixConnectivity::YALE)
                         ? "C" + s.first + ".connN"
-                        : to_string(s.second.getMaxConnections() * s.second.getSrcNeuronGroup()->getNumNeurons());
+                        : to_string((size_t)s.second.getMaxConnections() * (size_t)s.second.getSrcNeuronGroup()->getNumNeurons());
 
                     for(const auto &v : s.second.getWUModel()->getVars()) {
                         const VarMode varMode = s.second.getWUVarMode(v.first);
@@ -1321,6 +1409,9 @@ void genInit(const NNmodel &model,      //!< Model description
                     if (model.isSynapseGroupPostLearningRequired(s.first)) {
                         os << "createPosttoPreArray(" << numSrcNeurons << ", " << numTrgNeurons << ", &C" << s.first << ");" << std::endl;
                     }
+                    if (s.second.isDeltaEncodingEnabled()) {
+                        os << "createDeltaIndices(" << numSrcNeurons << ", &C" << s.first << ", &D" << s.first << ");" << std::endl;
+                    }
                 }
 
                 // If synapses in this population have individual variables
@@ -1349,7 +1440,7 @@ void genInit(const NNmodel &model,      //!< Model description
                                     os << "for (int j = 0; j < C" << s.first << ".rowLength[i]; j++)";
                                     {
                                         CodeStream::Scope b(os);
-                                        const std::string synIndex = "(i * " + std::to_string(s.second.getMaxConnections()) + ") + j";
+                                        const std::string synIndex = "(i * " + s.second.getSynapseIndexStride(s.second.getMaxConnections()) + ") + j";
                                         os << StandardSubstitutions::initWeightUpdateVariable(varInit,
                                                                                               wuVars[k].first + s.first + "[" + synIndex + "]",
                                                                                               cpuFunctions, "i", "C" + s.first + ".ind[" + synIndex + "]", 
@@ -1361,8 +1452,34 @@ void genInit(const NNmodel &model,      //!< Model description
                     }
                 }
 
+                // If ind is only required to build the delta-encoded copy, free it now this has been done
+                if (s.second.isDeltaEncodingIndFreed()) {
+                    os << "delete[] C" << s.first << ".ind;" << std::endl;
+                    os << "C" << s.first << ".ind = NULL;" << std::endl;
+                }
+
 
             }
+            // Otherwise, if synapse dynamics are only applied to synapses with a non-zero variable, build bitmask of these synapses
+            else if (s.second.isSynapseDynamicsSkipMaskEnabled()) {
+                CodeStream::Scope b(os);
+                const unsigned int rowWords = (numTrgNeurons + 31) / 32;
+                const std::string &maskVar = s.second.getSynapseDynamicsSkipMaskVar();
+                os << "memset(synDynMask" << s.first << ", 0, " << (size_t)numSrcNeurons * rowWords << " * sizeof(unsigned int));" << std::endl;
+                os << "for (int i = 0; i < " << numSrcNeurons << "; i++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "for (int j = 0; j < " << numTrgNeurons << "; j++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "if (" << maskVar << s.first << "[(i * " << s.second.getSynapseIndexStride(numTrgNeurons) << ") + j] != 0)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "synDynMask" << s.first << "[(i * " << rowWords << ") + (j / 32)] |= (1u << (j % 32));" << std::endl;
+                        }
+                    }
+                }
+            }
         }
 
         os << std::endl << std::endl;
@@ -138,7 +138,7 @@ void generatePreParallelisedSparseCode(
             os << "npost = dd_indInG" << sg.getName() << "[preInd + 1] - prePos;" << std::endl;
         }
         else if(sg.getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
-            os << "prePos = preInd * " << to_string(sg.getMaxConnections()) << ";" << std::endl;
+            os << "prePos = preInd * " << sg.getSynapseIndexStride(sg.getMaxConnections()) << ";" << std::endl;
             os << "npost = dd_rowLength" << sg.getName() << "[preInd];" << std::endl;
         }
         else if (sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
@@ -316,7 +316,7 @@ void generatePostParallelisedCode(
                         os << "npost = dd_indInG" << sg.getName() << "[shSpk" << postfix << "[j] + 1] - prePos;" << std::endl;
                     }
                     else {
-                        os << "prePos = shSpk" << postfix << "[j] * " << to_string(sg.getMaxConnections()) << ";" << std::endl;
+                        os << "prePos = shSpk" << postfix << "[j] * " << sg.getSynapseIndexStride(sg.getMaxConnections()) << ";" << std::endl;
                         os << "npost = shRowLength" << postfix << "[j];" << std::endl;
                     }
 
@@ -371,7 +371,7 @@ void generatePostParallelisedCode(
                     }
                     else {
                         name_substitutions(wCode, "dd_", wuVars.nameBegin, wuVars.nameEnd,
-                                           sg.getName() + "[shSpk" + postfix + "[j] * " + to_string(sg.getTrgNeuronGroup()->getNumNeurons()) + "+ ipost]");
+                                           sg.getName() + "[shSpk" + postfix + "[j] * " + sg.getSynapseIndexStride(sg.getTrgNeuronGroup()->getNumNeurons()) + "+ ipost]");
                     }
                 }
 
@@ -970,7 +970,7 @@ void genSynapseKernel(const NNmodel &model, //!< Model description
                                 std::string synIdx;
                                 std::string preIdx;
                                 if(sg->getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
-                                    os << "const unsigned int s = dd_synRemap" << s->first << "[1 + " << localID << "];" << std::endl;
+                                    os << "const " << sg->getSynapseIndexType() << " s = dd_synRemap" << s->first << "[1 + " << localID << "];" << std::endl;
                                     synIdx = "s";
                                     preIdx = "s / " + to_string(sg->getMaxConnections());
 
@@ -1087,7 +1087,10 @@ void genSynapseKernel(const NNmodel &model, //!< Model description
         os << "unsigned int ipost;" << std::endl;
         for(const auto &s : model.getLocalSynapseGroups()) {
             if (s.second.getMatrixType()  & SynapseMatrixConnectivity::SPARSE){
-                os << "unsigned int prePos; " << std::endl;
+                // **NOTE** prePos indexes synapses so must be 64-bit if any group requires it
+                const bool synapseIndex64Bit = std::any_of(model.getLocalSynapseGroups().cbegin(), model.getLocalSynapseGroups().cend(),
+                                                           [](const NNmodel::SynapseGroupValueType &s){ return s.second.isSynapseIndex64BitRequired(); });
+                os << (synapseIndex64Bit ? "uint64_t" : "unsigned int") << " prePos; " << std::endl;
                 os << "unsigned int npost; " << std::endl;
                 break;
             }
@@ -1384,7 +1387,7 @@ void genSynapseKernel(const NNmodel &model, //!< Model description
                                         os << "unsigned int npre = dd_revIndInG" << s->first << "[shSpk[j] + 1] - iprePos;" << std::endl;
                                     }
                                     else {
-                                        os << "unsigned int iprePos = shSpk[j] * " << to_string(sg->getMaxSourceConnections()) << ";" << std::endl;
+                                        os << sg->getSynapseIndexType() << " iprePos = shSpk[j] * " << sg->getSynapseIndexStride(sg->getMaxSourceConnections()) << ";" << std::endl;
                                         os << "unsigned int npre = shColLength[j];" << std::endl;
                                     }
                                     os << "if (" << localID << " < npre)" << CodeStream::OB(1540);
@@ -1419,7 +1422,7 @@ void genSynapseKernel(const NNmodel &model, //!< Model description
                                     }
                                 }
                                 else { // DENSE
-                                    name_substitutions(code, "dd_", wuVars.nameBegin, wuVars.nameEnd, s->first + "[" + localID + " * " + to_string(sg->getTrgNeuronGroup()->getNumNeurons()) + " + shSpk[j]]");
+                                    name_substitutions(code, "dd_", wuVars.nameBegin, wuVars.nameEnd, s->first + "[" + localID + " * " + sg->getSynapseIndexStride(sg->getTrgNeuronGroup()->getNumNeurons()) + " + shSpk[j]]");
                                     preIndex = localID;
                                 }
                                 StandardSubstitutions::weightUpdatePostLearn(code, sg, wuPreVars, wuPostVars, wuDerivedParams, wuExtraGlobalParams,
@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <cmath>
 #include <cstdint>
 
 //--------------------------------------------------------------------------
@@ -155,6 +156,14 @@ void allocate_variable(CodeStream &os, const string &type, const string &name, V
     allocate_device_variable(os, type, name, mode, size);
 }
 
+//--------------------------------------------------------------------------
+//! \brief This function generates allocation code for a host variable stored in a memory-mapped file
+//--------------------------------------------------------------------------
+void allocate_out_of_core_variable(CodeStream &os, const string &type, const string &name, const string &fileName, const string &size)
+{
+    os << name << " = FileBackedArray::allocate<" << type << ">(\"" << GENN_PREFERENCES::outOfCoreDirectory << "\", \"" << fileName << "\", " << size << ");" << std::endl;
+}
+
 void free_host_variable(CodeStream &os, const string &name, VarMode mode)
 {
 #ifndef CPU_ONLY
@@ -406,7 +415,10 @@ void writeTypeRange(CodeStream &os, const std::string &precision, const std::str
 {
     os << "#ifndef " << prefix << "_MIN" << std::endl;
     os << "#define " << prefix << "_MIN ";
-    if (precision == "float") {
+    if (isFixedPointType(precision)) {
+        os << precision << "::fromRaw(1)" << std::endl;
+    }
+    else if (precision == "float") {
         writePreciseString(os, std::numeric_limits<float>::min());
         os << "f" << std::endl;
     }
@@ -418,7 +430,10 @@ void writeTypeRange(CodeStream &os, const std::string &precision, const std::str
 
     os << "#ifndef " << prefix << "_MAX" << std::endl;
     os << "#define " << prefix << "_MAX ";
-    if (precision == "float") {
+    if (isFixedPointType(precision)) {
+        os << precision << "::fromRaw(INT32_MAX)" << std::endl;
+    }
+    else if (precision == "float") {
         writePreciseString(os, std::numeric_limits<float>::max());
         os << "f" << std::endl;
     }
@@ -429,6 +444,115 @@ void writeTypeRange(CodeStream &os, const std::string &precision, const std::str
     os << "#endif" << std::endl;
     os << std::endl;
 }
+
+//--------------------------------------------------------------------------
+/*! \brief This function generates a lookup table and the function used to evaluate it in place of a function in neuron code
+ */
+//--------------------------------------------------------------------------
+void genFunctionTable(CodeStream &os, const NNmodel &model, const NeuronGroup &ng, const FunctionTable &table)
+{
+    const string &precision = model.getPrecision();
+    const string name = table.getTableFunctionName(ng.getName());
+    const bool linear = (table.getInterpolation() == FunctionTable::Interpolation::LINEAR);
+
+    // Write values at full precision of the model's scalar type
+    auto literal = [&precision](double value)
+    {
+        return (precision == "float") ? (writePreciseString((float)value) + "f") : writePreciseString(value);
+    };
+
+    // Report accuracy of table
+    const auto maxError = table.getMaxError();
+    cout << "Function table for " << table.getFunctionName() << " in population " << ng.getName() << ": ";
+    cout << "maximum absolute error " << maxError.first << ", maximum relative error " << maxError.second << std::endl;
+
+    os << "// " << (linear ? "linear" : "cubic") << " interpolation table for " << table.getFunctionName() << " over [" << table.getMin() << ", " << table.getMax() << ")";
+    os << " - maximum absolute error " << maxError.first << ", maximum relative error " << maxError.second << std::endl;
+    const vector<double> entries = table.getEntries();
+    os << "static const " << precision << " " << name << "Entries[" << entries.size() << "] = {";
+    for(size_t i = 0; i < entries.size(); i++) {
+        if(!std::isfinite(entries[i])) {
+            gennError("Function table for '" + table.getFunctionName() + "' in population " + ng.getName() + " contains non-finite values - its range should be reduced.");
+        }
+        os << ((i % 8) == 0 ? "\n    " : " ") << literal(entries[i]) << ((i == (entries.size() - 1)) ? "" : ",");
+    }
+    os << "};" << std::endl;
+
+    // Calls outside the table's range - and on the GPU where maths functions are cheap relative to memory - use the original function
+    const string original = table.isMathsFunction()
+        ? ensureFtype(table.getFunctionName() + "(x)", precision)
+        : (ng.getName() + "_neuron::" + table.getFunctionName() + "(x)");
+    os << "__host__ __device__ static inline " << precision << " " << name << "(" << precision << " x)";
+    {
+        CodeStream::Scope b(os);
+        os << "#ifdef __CUDA_ARCH__" << std::endl;
+        os << "return " << original << ";" << std::endl;
+        os << "#else" << std::endl;
+        os << "const " << precision << " pos = (x - " << literal(table.getMin()) << ") * " << literal((double)table.getNumIntervals() / (table.getMax() - table.getMin())) << ";" << std::endl;
+        os << "if (pos >= 0 && pos < " << table.getNumIntervals() << ")";
+        {
+            CodeStream::Scope b(os);
+            os << "const int i = (int)pos;" << std::endl;
+            os << "const " << precision << " f = pos - i;" << std::endl;
+            if(linear) {
+                os << "return " << name << "Entries[i] + (f * (" << name << "Entries[i + 1] - " << name << "Entries[i]));" << std::endl;
+            }
+            else {
+                // **NOTE** entries are offset by one so the entry before the interval is at i
+                for(unsigned int p = 0; p < 4; p++) {
+                    os << "const " << precision << " p" << p << " = " << name << "Entries[i + " << p << "];" << std::endl;
+                }
+                os << "return p1 + (" << literal(0.5) << " * f * ((p2 - p0) + (f * (((" << literal(2.0) << " * p0) - (" << literal(5.0) << " * p1) + (" << literal(4.0) << " * p2) - p3)";
+                os << " + (f * ((" << literal(3.0) << " * (p1 - p2)) + p3 - p0))))));" << std::endl;
+            }
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "return " << original << ";" << std::endl;
+        }
+        os << "#endif" << std::endl;
+    }
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+//! \brief This function generates the signatures of the functions used to set a group's parameters which can be changed at runtime
+/*! As derived parameters are calculated by the model definition, the new values of any which depend
+    on a parameter are passed to its setter alongside it, rather than being recalculated */
+//--------------------------------------------------------------------------
+std::vector<std::string> getDynamicParamSetterSignatures(const std::vector<std::pair<std::string, std::vector<std::string>>> &dynamicParamDependents,
+                                                         const std::string &groupName)
+{
+    std::vector<std::string> signatures;
+    for(const auto &p : dynamicParamDependents) {
+        std::string signature = "void set" + p.first + groupName + "(scalar " + p.first;
+        for(const auto &d : p.second) {
+            signature += ", scalar " + d;
+        }
+        signatures.push_back(signature + ")");
+    }
+    return signatures;
+}
+
+//--------------------------------------------------------------------------
+//! \brief This function generates the functions used to set a group's parameters which can be changed at runtime
+//--------------------------------------------------------------------------
+void genDynamicParamSetters(CodeStream &os, const std::vector<std::pair<std::string, std::vector<std::string>>> &dynamicParamDependents,
+                            const std::string &groupName)
+{
+    const auto signatures = getDynamicParamSetterSignatures(dynamicParamDependents, groupName);
+    for(size_t i = 0; i < signatures.size(); i++) {
+        os << signatures[i];
+        {
+            CodeStream::Scope b(os);
+            os << dynamicParamDependents[i].first << groupName << " = " << dynamicParamDependents[i].first << ";" << std::endl;
+            for(const auto &d : dynamicParamDependents[i].second) {
+                os << d << groupName << " = " << d << ";" << std::endl;
+            }
+        }
+        os << std::endl;
+    }
+}
 }   // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -481,6 +605,24 @@ void genDefinitions(const NNmodel &model,   //!< Model description
 #endif
     os << "#include \"sparseUtils.h\"" << std::endl << std::endl;
     os << "#include \"sparseProjection.h\"" << std::endl;
+    if (model.isFixedPointPrecision()) {
+        os << "#include \"fixedPoint.h\"" << std::endl;
+    }
+    const bool reducedPrecisionStorage = std::any_of(model.getLocalSynapseGroups().cbegin(), model.getLocalSynapseGroups().cend(),
+        [](const NNmodel::SynapseGroupValueType &s){ return s.second.isWUVarReducedPrecisionStorageRequired(); });
+    if (reducedPrecisionStorage) {
+        os << "#include \"reducedPrecision.h\"" << std::endl;
+    }
+    const bool outOfCore = std::any_of(model.getLocalSynapseGroups().cbegin(), model.getLocalSynapseGroups().cend(),
+        [](const NNmodel::SynapseGroupValueType &s){ return s.second.isOutOfCore(); });
+    if (outOfCore) {
+        os << "#include \"fileBackedArray.h\"" << std::endl;
+    }
+    const bool connectivityFile = std::any_of(model.getLocalSynapseGroups().cbegin(), model.getLocalSynapseGroups().cend(),
+        [](const NNmodel::SynapseGroupValueType &s){ return s.second.isConnectivityFileLoadSupported(); });
+    if (connectivityFile) {
+        os << "#include \"connectivityFile.h\"" << std::endl;
+    }
     os << "#include <cstdint>" << std::endl;
     os << "#include <random>" << std::endl;
 #ifndef CPU_ONLY
@@ -529,6 +671,12 @@ void genDefinitions(const NNmodel &model,   //!< Model description
     os << "typedef " << model.getPrecision() << " scalar;" << std::endl;
     os << "#endif" << std::endl;
 
+    // Reduced precision storage types are read back as scalar so arithmetic is performed at model precision
+    if (reducedPrecisionStorage) {
+        os << "typedef ReducedPrecision<HalfFormat, scalar> Half;" << std::endl;
+        os << "typedef ReducedPrecision<BFloat16Format, scalar> BFloat16;" << std::endl;
+    }
+
     // Write ranges of scalar and time types
     writeTypeRange(os, model.getPrecision(), "SCALAR");
     writeTypeRange(os, model.getTimePrecision(), "TIME");
@@ -656,7 +804,17 @@ void genDefinitions(const NNmodel &model,   //!< Model description
             os << varExportPrefix << " unsigned int spkQuePtr" << n.first << ";" << std::endl;
         }
         if (n.second.isSpikeTimeRequired()) {
-            extern_variable_def(os, model.getTimePrecision()+" *", "sT"+n.first, n.second.getSpikeTimeVarMode());
+            extern_variable_def(os, n.second.getSpikeTimeType(model.getTimePrecision())+" *", "sT"+n.first, n.second.getSpikeTimeVarMode());
+        }
+        if (n.second.isVersionedDelayQueueRequired()) {
+            os << varExportPrefix << " unsigned int *versionHead" << n.first << ";" << std::endl;
+            os << varExportPrefix << " long long *versionStep" << n.first << ";" << std::endl;
+        }
+        if (n.second.isActiveSetUpdateEnabled()) {
+            os << varExportPrefix << " unsigned int *activeMask" << n.first << ";" << std::endl;
+            if (!n.second.getCurrentSources().empty()) {
+                os << varExportPrefix << " " << model.getPrecision() << " *csInput" << n.first << ";" << std::endl;
+            }
         }
 #ifndef CPU_ONLY
         if(n.second.isSimRNGRequired()) {
@@ -670,6 +828,9 @@ void genDefinitions(const NNmodel &model,   //!< Model description
         for(auto const &v : neuronModel->getExtraGlobalParams()) {
             os << "extern " << v.second << " " << v.first + n.first << ";" << std::endl;
         }
+        for(auto const &p : n.second.getDynamicParamValues()) {
+            os << "extern scalar " << p.first << ";" << std::endl;
+        }
         os << "// current source variables" << std::endl;
         for (auto const *cs : n.second.getCurrentSources()) {
             auto csModel = cs->getCurrentSourceModel();
@@ -745,7 +906,9 @@ void genDefinitions(const NNmodel &model,   //!< Model description
             extern_variable_def(os, model.getPrecision() + " *", "inSyn" + sg->getPSModelTargetName(), sg->getInSynVarMode());
 
             if (sg->isDendriticDelayRequired()) {
-                extern_variable_def(os, model.getPrecision() + " *", "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayVarMode());
+                if(!sg->isSparseDendriticDelayEnabled()) {
+                    extern_variable_def(os, model.getPrecision() + " *", "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayVarMode());
+                }
                 os << varExportPrefix << " unsigned int denDelayPtr" << sg->getPSModelTargetName() << ";" << std::endl;
             }
 
@@ -779,13 +942,19 @@ void genDefinitions(const NNmodel &model,   //!< Model description
             if(s.second.getSparseConnectivityVarMode() & VarLocation::HOST)
 #endif
             {
-                os << varExportPrefix << " RaggedProjection<unsigned int> C" << s.first << ";" << std::endl;
+                os << varExportPrefix << " RaggedProjection<unsigned int, " << s.second.getSynapseIndexType() << "> C" << s.first << ";" << std::endl;
+            }
+            if(s.second.isDeltaEncodingEnabled()) {
+                os << varExportPrefix << " DeltaProjection D" << s.first << ";" << std::endl;
             }
         }
 
         if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
             for(const auto &v : s.second.getWUModel()->getVars()) {
-                extern_variable_def(os, v.second + " *", v.first + s.first, s.second.getWUVarMode(v.first));
+                if(s.second.getWUVarStorageType(v.first) == VarStorageType::CODEBOOK8) {
+                    os << varExportPrefix << " const " << v.second << " " << v.first << "Codebook" << s.first << "[" << s.second.getWUVarCodebook(v.first).size() << "];" << std::endl;
+                }
+                extern_variable_def(os, s.second.getWUVarStorageTypeName(v.first) + " *", v.first + s.first, s.second.getWUVarMode(v.first));
             }
         }
 
@@ -802,6 +971,10 @@ void genDefinitions(const NNmodel &model,   //!< Model description
             os << "extern " << p.second << " " << p.first + s.first << ";" << std::endl;
         }
 
+        for(auto const &p : s.second.getDynamicParamValues()) {
+            os << "extern scalar " << p.first << ";" << std::endl;
+        }
+
         for(auto const &p : s.second.getConnectivityInitialiser().getSnippet()->getExtraGlobalParams()) {
             os << "extern " << p.second << " initSparseConn" << p.first + s.first << ";" << std::endl;
         }
@@ -965,6 +1138,36 @@ void genDefinitions(const NNmodel &model,   //!< Model description
         }
     }
 
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// Functions to load sparse connectivity and weights from files written by" << std::endl;
+    os << "// gen_syns_parallel. They must be called after allocateMem() and initialize()" << std::endl;
+    os << "// but before the model's init function. Weights are loaded into the variable" << std::endl;
+    os << "// set with SynapseGroup::setConnectivityFileWeightVar, if any." << std::endl;
+    os << std::endl;
+    for(const auto &s : model.getLocalSynapseGroups()) {
+        if (s.second.isConnectivityFileLoadSupported()) {
+            os << funcExportPrefix << "void load" << s.first << "Connectivity(const std::string &filename);" << std::endl;
+            os << std::endl;
+        }
+    }
+
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// Functions to set parameters which can be changed at runtime. Derived parameters" << std::endl;
+    os << "// are calculated by the model definition so are not recalculated by the generated" << std::endl;
+    os << "// code - the new values of any which depend on a parameter are passed alongside it." << std::endl;
+    os << std::endl;
+    for(const auto &n : model.getLocalNeuronGroups()) {
+        for(const auto &f : getDynamicParamSetterSignatures(n.second.getDynamicParamDependents(), n.first)) {
+            os << funcExportPrefix << f << ";" << std::endl;
+        }
+    }
+    for(const auto &s : model.getLocalSynapseGroups()) {
+        for(const auto &f : getDynamicParamSetterSignatures(s.second.getDynamicParamDependents(), s.first)) {
+            os << funcExportPrefix << f << ";" << std::endl;
+        }
+    }
+    os << std::endl;
+
     os << "// ------------------------------------------------------------------------" << std::endl;
     os << "// Function to (re)set all model variables to their compile-time, homogeneous initial" << std::endl;
     os << "// values. Note that this typically includes synaptic weight values. The function" << std::endl;
@@ -1159,6 +1362,13 @@ void genSupportCode(const NNmodel &model, //!< Model description
         }
 
     }
+
+    // write lookup tables used in place of functions in neuron code
+    for(const auto &n : model.getLocalNeuronGroups()) {
+        for(const auto &f : n.second.getFunctionTables()) {
+            genFunctionTable(os, model, n.second, f);
+        }
+    }
     os << "#endif" << std::endl;
     fs.close();
 }
@@ -1200,6 +1410,15 @@ void genRunner(const NNmodel &model,    //!< Model description
     os << "#include <ctime>" << std::endl;
     os << "#include <cassert>" << std::endl;
     os << "#include <stdint.h>" << std::endl;
+    if(model.canRunOnCPU() && (model.isPhaseOverlapRequired() || model.getMaxSpikePropagationThreads() > 1)) {
+        os << "#include \"workerThread.h\"" << std::endl;
+    }
+    if(std::any_of(model.getLocalSynapseGroups().cbegin(), model.getLocalSynapseGroups().cend(),
+                   [](const NNmodel::SynapseGroupValueType &s){ return s.second.isDendriticDelayRequired() && s.second.isSparseDendriticDelayEnabled(); }))
+    {
+        os << "#include <utility>" << std::endl;
+        os << "#include <vector>" << std::endl;
+    }
 
     // **NOTE** if we are using GCC on x86_64, bugs in some version of glibc can cause
     // bad performance issues so need this to allow us to perform a runtime check
@@ -1329,7 +1548,17 @@ void genRunner(const NNmodel &model,    //!< Model description
 #endif
         }
         if (n.second.isSpikeTimeRequired()) {
-            variable_def(os, model.getTimePrecision()+" *", "sT"+n.first, n.second.getSpikeTimeVarMode());
+            variable_def(os, n.second.getSpikeTimeType(model.getTimePrecision())+" *", "sT"+n.first, n.second.getSpikeTimeVarMode());
+        }
+        if (n.second.isVersionedDelayQueueRequired()) {
+            os << "unsigned int *versionHead" << n.first << ";" << std::endl;
+            os << "long long *versionStep" << n.first << ";" << std::endl;
+        }
+        if (n.second.isActiveSetUpdateEnabled()) {
+            os << "unsigned int *activeMask" << n.first << ";" << std::endl;
+            if (!n.second.getCurrentSources().empty()) {
+                os << model.getPrecision() << " *csInput" << n.first << ";" << std::endl;
+            }
         }
 #ifndef CPU_ONLY
         if(n.second.isSimRNGRequired()) {
@@ -1345,6 +1574,9 @@ void genRunner(const NNmodel &model,    //!< Model description
         for(auto const &v : neuronModel->getExtraGlobalParams()) {
             os << v.second << " " <<  v.first << n.first << ";" << std::endl;
         }
+        for(auto const &p : n.second.getDynamicParamValues()) {
+            os << "scalar " << p.first << " = " << writePreciseString(p.second) << ";" << std::endl;
+        }
         os << "// current source variables" << std::endl;
         for (auto const *cs : n.second.getCurrentSources()) {
             auto csModel = cs->getCurrentSourceModel();
@@ -1368,7 +1600,14 @@ void genRunner(const NNmodel &model,    //!< Model description
             variable_def(os, model.getPrecision() + " *", "inSyn" + sg->getPSModelTargetName(), sg->getInSynVarMode());
 
             if(sg->isDendriticDelayRequired()) {
-                variable_def(os, model.getPrecision() + " *", "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayVarMode());
+                // If dendritic delay is sparse, add list of (postsynaptic neuron, value) pairs for each delay slot
+                if(sg->isSparseDendriticDelayEnabled()) {
+                    os << "std::vector<std::pair<unsigned int, " << model.getPrecision() << ">> denDelayQueue" << sg->getPSModelTargetName();
+                    os << "[" << sg->getMaxDendriticDelayTimesteps() << "];" << std::endl;
+                }
+                else {
+                    variable_def(os, model.getPrecision() + " *", "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayVarMode());
+                }
 
                 os << "unsigned int denDelayPtr" << sg->getPSModelTargetName() << ";" << std::endl;
 #ifndef CPU_ONLY
@@ -1428,7 +1667,10 @@ void genRunner(const NNmodel &model,    //!< Model description
             if(s.second.getSparseConnectivityVarMode() & VarLocation::HOST)
 #endif
             {
-                os << "RaggedProjection<unsigned int> C" << s.first << "(" << s.second.getMaxConnections() << "," << s.second.getMaxSourceConnections() << ");" << std::endl;
+                os << "RaggedProjection<unsigned int, " << s.second.getSynapseIndexType() << "> C" << s.first << "(" << s.second.getMaxConnections() << "," << s.second.getMaxSourceConnections() << ");" << std::endl;
+            }
+            if(s.second.isDeltaEncodingEnabled()) {
+                os << "DeltaProjection D" << s.first << ";" << std::endl;
             }
 #ifndef CPU_ONLY
             if(s.second.getSparseConnectivityVarMode() & VarLocation::DEVICE) {
@@ -1437,15 +1679,16 @@ void genRunner(const NNmodel &model,    //!< Model description
                 os << "unsigned int *d_ind" << s.first << ";" << std::endl;
                 os << "__device__ unsigned int *dd_ind" << s.first << ";" << std::endl;
 
+                const std::string synIndexType = s.second.getSynapseIndexType();
                 if (model.isSynapseGroupDynamicsRequired(s.first)) {
-                    os << "unsigned int *d_synRemap" << s.first << ";" << std::endl;
-                    os << "__device__ unsigned int *dd_synRemap" << s.first << ";" << std::endl;
+                    os << synIndexType << " *d_synRemap" << s.first << ";" << std::endl;
+                    os << "__device__ " << synIndexType << " *dd_synRemap" << s.first << ";" << std::endl;
                 }
                 if (model.isSynapseGroupPostLearningRequired(s.first)) {
                     os << "unsigned int *d_colLength" << s.first << ";" << std::endl;
                     os << "__device__ unsigned int *dd_colLength" << s.first << ";" << std::endl;
-                    os << "unsigned int *d_remap" << s.first << ";" << std::endl;
-                    os << "__device__ unsigned int *dd_remap" << s.first << ";" << std::endl;
+                    os << synIndexType << " *d_remap" << s.first << ";" << std::endl;
+                    os << "__device__ " << synIndexType << " *dd_remap" << s.first << ";" << std::endl;
                 }
             }
 #endif  // CPU_ONLY
@@ -1455,7 +1698,16 @@ void genRunner(const NNmodel &model,    //!< Model description
         // If weight update variables should be individual
         if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
             for(const auto &v : wu->getVars()) {
-                variable_def(os, v.second + " *", v.first + s.first, s.second.getWUVarMode(v.first));
+                if(s.second.getWUVarStorageType(v.first) == VarStorageType::CODEBOOK8) {
+                    const auto &codebook = s.second.getWUVarCodebook(v.first);
+                    os << "const " << v.second << " " << v.first << "Codebook" << s.first << "[" << codebook.size() << "] = {";
+                    for(size_t c = 0; c < codebook.size(); c++) {
+                        os << ((c == 0) ? "" : ", ");
+                        writePreciseString(os, codebook[c]);
+                    }
+                    os << "};" << std::endl;
+                }
+                variable_def(os, s.second.getWUVarStorageTypeName(v.first) + " *", v.first + s.first, s.second.getWUVarMode(v.first));
             }
         }
 
@@ -1471,9 +1723,37 @@ void genRunner(const NNmodel &model,    //!< Model description
             os << v.second << " " <<  v.first << s.first << ";" << std::endl;
         }
 
+        for(auto const &p : s.second.getDynamicParamValues()) {
+            os << "scalar " << p.first << " = " << writePreciseString(p.second) << ";" << std::endl;
+        }
+
         for(auto const &p : s.second.getConnectivityInitialiser().getSnippet()->getExtraGlobalParams()) {
             os << p.second << " initSparseConn" << p.first + s.first << ";" << std::endl;
         }
+
+        // If synapse dynamics are gated by presynaptic activity, add list of active
+        // rows and the timestep at which each row was last activated by a spike
+        if(s.second.isSynapseDynamicsActivityGated()) {
+            os << "unsigned int activeRowCount" << s.first << ";" << std::endl;
+            os << "unsigned int *activeRows" << s.first << ";" << std::endl;
+            os << "unsigned long long *rowActiveStep" << s.first << ";" << std::endl;
+        }
+
+        // If spike propagation is split between threads, add private copies of the buffer
+        // input is accumulated into for each thread other than the simulation thread
+        if(s.second.getSpikePropagationThreads() > 1) {
+            os << model.getPrecision() << " *" << (s.second.isDendriticDelayRequired() ? "denDelay" : "inSyn") << "Private" << s.first << ";" << std::endl;
+        }
+
+        // If synapse dynamics skip synapses, add bitmask of synapses to apply them to
+        if(s.second.isSynapseDynamicsSkipMaskEnabled()) {
+            os << "unsigned int *synDynMask" << s.first << ";" << std::endl;
+        }
+
+        // If spikes are processed against blocks of postsynaptic neurons, add position reached in each spike's row
+        if(s.second.isCacheBlocked() && (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+            os << "unsigned int *blockRowPos" << s.first << ";" << std::endl;
+        }
     }
     os << std::endl;
     
@@ -1528,10 +1808,25 @@ void genRunner(const NNmodel &model,    //!< Model description
 #ifdef MPI_ENABLE
     os << "#include \"mpi.cc\"" << std::endl;
 #endif
+#ifdef CPU_ONLY
+    // **NOTE** build_model_runner compiles init.cc separately so it can be built in parallel
+    os << "#ifndef SEPARATE_INIT_CC" << std::endl;
+    os << "#include \"init.cc\"" << std::endl;
+    os << "#endif" << std::endl;
+#else
     os << "#include \"init.cc\"" << std::endl;
+#endif
 
     // If model can be run on GPU, include CPU simulation functions
     if(model.canRunOnCPU()) {
+        if(model.isPhaseOverlapRequired()) {
+            os << "// worker thread used to propagate spikes through overlapped synapse groups during the neuron update" << std::endl;
+            os << "WorkerThread *overlapWorker = NULL;" << std::endl;
+        }
+        if(model.getMaxSpikePropagationThreads() > 1) {
+            os << "// worker threads used to propagate spikes alongside the simulation thread" << std::endl;
+            os << "WorkerThread *propagationWorkers[" << model.getMaxSpikePropagationThreads() - 1 << "];" << std::endl;
+        }
         os << "#include \"neuronFnct.cc\"" << std::endl;
         if (!model.getLocalSynapseGroups().empty()) {
             os << "#include \"synapseFnct.cc\"" << std::endl;
@@ -1611,6 +1906,20 @@ void genRunner(const NNmodel &model,    //!< Model description
             os << "sparseInitDevice_tme = 0.0;" << std::endl;
         }
 
+        // Start worker thread used for phase overlap
+        if(model.canRunOnCPU() && model.isPhaseOverlapRequired()) {
+            os << "overlapWorker = new WorkerThread();" << std::endl;
+        }
+
+        // Start worker threads used to propagate spikes
+        if(model.canRunOnCPU() && model.getMaxSpikePropagationThreads() > 1) {
+            os << "for (unsigned int w = 0; w < " << model.getMaxSpikePropagationThreads() - 1 << "; w++)";
+            {
+                CodeStream::Scope b(os);
+                os << "propagationWorkers[w] = new WorkerThread();" << std::endl;
+            }
+        }
+
         // ALLOCATE REMOTE NEURON VARIABLES
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// remote neuron groups" << std::endl;
@@ -1657,10 +1966,28 @@ void genRunner(const NNmodel &model,    //!< Model description
 
             // Allocate buffer to hold last spike times if required
             if (n.second.isSpikeTimeRequired()) {
-                mem += allocate_variable(os, model.getTimePrecision(), "sT" + n.first, n.second.getSpikeTimeVarMode(),
+                mem += allocate_variable(os, n.second.getSpikeTimeType(model.getTimePrecision()), "sT" + n.first, n.second.getSpikeTimeVarMode(),
                                          n.second.getNumNeurons() * n.second.getNumDelaySlots());
             }
 
+            // Allocate host-side head and timesteps of versioned queue entries if required
+            if (n.second.isVersionedDelayQueueRequired()) {
+                allocate_host_variable(os, "unsigned int", "versionHead" + n.first, VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                       n.second.getNumNeurons());
+                allocate_host_variable(os, "long long", "versionStep" + n.first, VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                       n.second.getNumNeurons() * n.second.getNumDelaySlots());
+            }
+
+            // Allocate host-side bitmask of active neurons, padded to a whole word, and the input from current sources to them
+            if (n.second.isActiveSetUpdateEnabled()) {
+                allocate_host_variable(os, "unsigned int", "activeMask" + n.first, VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                       (n.second.getNumNeurons() + 31) / 32);
+                if (!n.second.getCurrentSources().empty()) {
+                    allocate_host_variable(os, model.getPrecision(), "csInput" + n.first, VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                           n.second.getNumNeurons());
+                }
+            }
+
 #ifndef CPU_ONLY
             if(n.second.isSimRNGRequired()) {
                 mem += allocate_device_variable(os, "curandState", "rng" + n.first, VarMode::LOC_DEVICE_INIT_DEVICE,
@@ -1695,7 +2022,7 @@ void genRunner(const NNmodel &model,    //!< Model description
                                          sg->getTrgNeuronGroup()->getNumNeurons());
 
                 // Allocate buffer to delay input coming from this synapse population
-                if(sg->isDendriticDelayRequired()) {
+                if(sg->isDendriticDelayRequired() && !sg->isSparseDendriticDelayEnabled()) {
                     mem += allocate_variable(os, model.getPrecision(), "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayVarMode(),
                                              sg->getMaxDendriticDelayTimesteps() * sg->getTrgNeuronGroup()->getNumNeurons());
                 }
@@ -1739,7 +2066,8 @@ void genRunner(const NNmodel &model,    //!< Model description
                 mem += allocate_variable(os, "uint32_t", "gp" + s.first, s.second.getSparseConnectivityVarMode(), gpSize);
             }
             else if(s.second.getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
-                const size_t size = s.second.getSrcNeuronGroup()->getNumNeurons() * s.second.getMaxConnections();
+                const size_t size = (size_t)s.second.getSrcNeuronGroup()->getNumNeurons() * (size_t)s.second.getMaxConnections();
+                const std::string synIndexType = s.second.getSynapseIndexType();
 
                 // Allocate row lengths
                 allocate_host_variable(os, "unsigned int", "C" + s.first + ".rowLength", s.second.getSparseConnectivityVarMode(),
@@ -1749,8 +2077,13 @@ void genRunner(const NNmodel &model,    //!< Model description
 
                 // Allocate target indices
                 const std::string postIndexType = "unsigned int";
-                allocate_host_variable(os, postIndexType, "C" + s.first + ".ind", s.second.getSparseConnectivityVarMode(),
-                                       size);
+                if(s.second.isOutOfCore()) {
+                    allocate_out_of_core_variable(os, postIndexType, "C" + s.first + ".ind", "ind" + s.first, std::to_string(size));
+                }
+                else {
+                    allocate_host_variable(os, postIndexType, "C" + s.first + ".ind", s.second.getSparseConnectivityVarMode(),
+                                           size);
+                }
                 mem += allocate_device_variable(os, postIndexType, "ind" + s.first, s.second.getSparseConnectivityVarMode(),
                                                 size);
 
@@ -1764,24 +2097,29 @@ void genRunner(const NNmodel &model,    //!< Model description
                                                     s.second.getTrgNeuronGroup()->getNumNeurons());
                     
                     // Allocate remap
-                    allocate_host_variable(os,  "unsigned int", "C" + s.first + ".remap", s.second.getSparseConnectivityVarMode(),
+                    allocate_host_variable(os, synIndexType, "C" + s.first + ".remap", s.second.getSparseConnectivityVarMode(),
                                            postSize);
-                    mem += allocate_device_variable(os,  "unsigned int", "remap" + s.first, s.second.getSparseConnectivityVarMode(),
+                    mem += allocate_device_variable(os, synIndexType, "remap" + s.first, s.second.getSparseConnectivityVarMode(),
                                                     postSize);
                 }
 
                 if(model.isSynapseGroupDynamicsRequired(s.first)) {
                     // Allocate synRemap
                     // **THINK** this is over-allocating
-                    allocate_host_variable(os,  "unsigned int", "C" + s.first + ".synRemap", s.second.getSparseConnectivityVarMode(),
+                    allocate_host_variable(os, synIndexType, "C" + s.first + ".synRemap", s.second.getSparseConnectivityVarMode(),
                                            size + 1);
-                    mem += allocate_device_variable(os,  "unsigned int", "synRemap" + s.first, s.second.getSparseConnectivityVarMode(),
+                    mem += allocate_device_variable(os, synIndexType, "synRemap" + s.first, s.second.getSparseConnectivityVarMode(),
                                                     size + 1);
                 }
                 
                 if(s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
                     for(const auto &v : wu->getVars()) {
-                        mem += allocate_variable(os, v.second, v.first + s.first, s.second.getWUVarMode(v.first), size);
+                        if(s.second.isOutOfCore()) {
+                            allocate_out_of_core_variable(os, s.second.getWUVarStorageTypeName(v.first), v.first + s.first, v.first + s.first, std::to_string(size));
+                        }
+                        else {
+                            mem += allocate_variable(os, s.second.getWUVarStorageTypeName(v.first), v.first + s.first, s.second.getWUVarMode(v.first), size);
+                        }
                     }
                 }
 
@@ -1789,11 +2127,45 @@ void genRunner(const NNmodel &model,    //!< Model description
             // Otherwise, if matrix connectivity is defined using a dense matrix, allocate user-defined weight model variables
             // **NOTE** if matrix is sparse, allocate later in the allocatesparsearrays function when we know the size of the network
             else if ((s.second.getMatrixType() & SynapseMatrixConnectivity::DENSE) && (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
-                const size_t size = s.second.getSrcNeuronGroup()->getNumNeurons() * s.second.getTrgNeuronGroup()->getNumNeurons();
+                const size_t size = (size_t)s.second.getSrcNeuronGroup()->getNumNeurons() * (size_t)s.second.getTrgNeuronGroup()->getNumNeurons();
 
                 for(const auto &v : wu->getVars()) {
-                    mem += allocate_variable(os, v.second, v.first + s.first, s.second.getWUVarMode(v.first), size);
+                    mem += allocate_variable(os, s.second.getWUVarStorageTypeName(v.first), v.first + s.first, s.second.getWUVarMode(v.first), size);
+                }
+            }
+
+            // Allocate host-side active row list used to gate synapse dynamics
+            if(s.second.isSynapseDynamicsActivityGated()) {
+                allocate_host_variable(os, "unsigned int", "activeRows" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                       s.second.getSrcNeuronGroup()->getNumNeurons());
+                allocate_host_variable(os, "unsigned long long", "rowActiveStep" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                       s.second.getSrcNeuronGroup()->getNumNeurons());
+            }
+
+            // Allocate host-side private input buffer used when propagating spikes on multiple threads
+            if(s.second.getSpikePropagationThreads() > 1) {
+                const size_t numCopies = s.second.getSpikePropagationThreads() - 1;
+                if(s.second.isDendriticDelayRequired()) {
+                    allocate_host_variable(os, model.getPrecision(), "denDelayPrivate" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                           numCopies * s.second.getTrgNeuronGroup()->getNumNeurons() * s.second.getMaxDendriticDelayTimesteps());
                 }
+                else {
+                    allocate_host_variable(os, model.getPrecision(), "inSynPrivate" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                           numCopies * s.second.getTrgNeuronGroup()->getNumNeurons());
+                }
+            }
+
+            // Allocate host-side bitmask of synapses to apply synapse dynamics to, with each row padded to a whole word
+            if(s.second.isSynapseDynamicsSkipMaskEnabled()) {
+                const unsigned int rowWords = (s.second.getTrgNeuronGroup()->getNumNeurons() + 31) / 32;
+                allocate_host_variable(os, "unsigned int", "synDynMask" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                       s.second.getSrcNeuronGroup()->getNumNeurons() * rowWords);
+            }
+
+            // Allocate host-side row positions used when processing spikes in blocks
+            if(s.second.isCacheBlocked() && (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+                allocate_host_variable(os, "unsigned int", "blockRowPos" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                       s.second.getSrcNeuronGroup()->getNumNeurons());
             }
             os << std::endl;
         }
@@ -1816,8 +2188,13 @@ void genRunner(const NNmodel &model,    //!< Model description
                                        s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
 
                 // Allocate the postsynaptic neuron indices that make up sparse matrix
-                allocate_host_variable(os, "unsigned int", "C" + s.first + ".ind", VarMode::LOC_HOST_DEVICE_INIT_HOST,
-                                       "connN");
+                if(s.second.isOutOfCore()) {
+                    allocate_out_of_core_variable(os, "unsigned int", "C" + s.first + ".ind", "ind" + s.first, "connN");
+                }
+                else {
+                    allocate_host_variable(os, "unsigned int", "C" + s.first + ".ind", VarMode::LOC_HOST_DEVICE_INIT_HOST,
+                                           "connN");
+                }
 
                 if (model.isSynapseGroupDynamicsRequired(s.first)) {
                     allocate_host_variable(os, "unsigned int", "C" + s.first + ".preInd", VarMode::LOC_HOST_DEVICE_INIT_HOST,
@@ -1867,7 +2244,12 @@ void genRunner(const NNmodel &model,    //!< Model description
                 // Allocate synapse variables
                 if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
                     for(const auto &v : s.second.getWUModel()->getVars()) {
-                        allocate_variable(os, v.second, v.first + s.first, s.second.getWUVarMode(v.first), numConnections);
+                        if(s.second.isOutOfCore()) {
+                            allocate_out_of_core_variable(os, s.second.getWUVarStorageTypeName(v.first), v.first + s.first, v.first + s.first, numConnections);
+                        }
+                        else {
+                            allocate_variable(os, s.second.getWUVarStorageTypeName(v.first), v.first + s.first, s.second.getWUVarMode(v.first), numConnections);
+                        }
                     }
                 }
             }
@@ -1882,12 +2264,100 @@ void genRunner(const NNmodel &model,    //!< Model description
         }
     }
 
+    // ------------------------------------------------------------------------
+    // setting parameters which can be changed at runtime
+
+    for(const auto &n : model.getLocalNeuronGroups()) {
+        genDynamicParamSetters(os, n.second.getDynamicParamDependents(), n.first);
+    }
+    for(const auto &s : model.getLocalSynapseGroups()) {
+        genDynamicParamSetters(os, s.second.getDynamicParamDependents(), s.first);
+    }
+
+    // ------------------------------------------------------------------------
+    // loading sparse connectivity from files
+
+    for(const auto &s : model.getLocalSynapseGroups()) {
+        if (s.second.isConnectivityFileLoadSupported()) {
+            const unsigned int numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
+            const unsigned int numTrgNeurons = s.second.getTrgNeuronGroup()->getNumNeurons();
+            const std::string &weightVar = s.second.getConnectivityFileWeightVar();
+            const bool loadWeights = !weightVar.empty();
+
+            os << "void load" << s.first << "Connectivity(const std::string &filename)";
+            {
+                CodeStream::Scope b(os);
+                os << "ConnectivityFile::Reader reader(filename);" << std::endl;
+                os << "reader.checkDimensions(" << numSrcNeurons << ", " << numTrgNeurons << ", \"" << s.first << "\");" << std::endl;
+                os << "std::vector<uint64_t> rowStart(" << numSrcNeurons + 1 << ");" << std::endl;
+                os << "reader.read(rowStart.data(), " << numSrcNeurons + 1 << ");" << std::endl;
+
+                // YALE rows are stored contiguously so indices and weights can be read in one go
+                if (s.second.getMatrixType() & SynapseMatrixConnectivity::YALE) {
+                    os << "if(reader.getHeader().numSynapses > UINT32_MAX)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "gennError(\"Connectivity file '\" + filename + \"' has too many synapses for synapse population '" << s.first << "'\");" << std::endl;
+                    }
+                    os << "allocate" << s.first << "((unsigned int)reader.getHeader().numSynapses);" << std::endl;
+                    os << "std::copy(rowStart.cbegin(), rowStart.cend(), C" << s.first << ".indInG);" << std::endl;
+                    os << "reader.read(C" << s.first << ".ind, C" << s.first << ".connN);" << std::endl;
+                    if (loadWeights) {
+                        os << "if(reader.hasWeights())";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "reader.readWeights(" << weightVar << s.first << ", C" << s.first << ".connN);" << std::endl;
+                        }
+                    }
+                }
+                // Otherwise, pad rows to maximum row length
+                else {
+                    os << "if(reader.getHeader().maxRowLength > " << s.second.getMaxConnections() << ")";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "gennError(\"Connectivity file '\" + filename + \"' has rows longer than the maximum row length of synapse population '" << s.first << "'\");" << std::endl;
+                    }
+                    os << "for(unsigned int i = 0; i < " << numSrcNeurons << "; i++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "C" << s.first << ".rowLength[i] = (unsigned int)(rowStart[i + 1] - rowStart[i]);" << std::endl;
+                        os << "reader.read(&C" << s.first << ".ind[i * " << s.second.getSynapseIndexStride(s.second.getMaxConnections()) << "], C" << s.first << ".rowLength[i]);" << std::endl;
+                    }
+                    if (loadWeights) {
+                        os << "if(reader.hasWeights())";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "for(unsigned int i = 0; i < " << numSrcNeurons << "; i++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "reader.readWeights(&" << weightVar << s.first << "[i * " << s.second.getSynapseIndexStride(s.second.getMaxConnections()) << "], C" << s.first << ".rowLength[i]);" << std::endl;
+                            }
+                        }
+                    }
+                }
+            }
+            os << std::endl;
+        }
+    }
+
     // ------------------------------------------------------------------------
     // freeing global memory structures
 
     os << "void freeMem()";
     {
         CodeStream::Scope b(os);
+        if(model.canRunOnCPU() && model.isPhaseOverlapRequired()) {
+            os << "delete overlapWorker;" << std::endl;
+            os << "overlapWorker = NULL;" << std::endl;
+        }
+        if(model.canRunOnCPU() && model.getMaxSpikePropagationThreads() > 1) {
+            os << "for (unsigned int w = 0; w < " << model.getMaxSpikePropagationThreads() - 1 << "; w++)";
+            {
+                CodeStream::Scope b(os);
+                os << "delete propagationWorkers[w];" << std::endl;
+                os << "propagationWorkers[w] = NULL;" << std::endl;
+            }
+        }
 #ifndef CPU_ONLY
         if(model.isDeviceRNGRequired()) {
             free_device_variable(os, "rng", VarMode::LOC_DEVICE_INIT_DEVICE);
@@ -1918,6 +2388,18 @@ void genRunner(const NNmodel &model,    //!< Model description
                 free_variable(os, "sT" + n.first, n.second.getSpikeTimeVarMode());
             }
 
+            if (n.second.isVersionedDelayQueueRequired()) {
+                free_host_variable(os, "versionHead" + n.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
+                free_host_variable(os, "versionStep" + n.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
+            }
+
+            if (n.second.isActiveSetUpdateEnabled()) {
+                free_host_variable(os, "activeMask" + n.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
+                if (!n.second.getCurrentSources().empty()) {
+                    free_host_variable(os, "csInput" + n.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
+                }
+            }
+
 #ifndef CPU_ONLY
             if(n.second.isSimRNGRequired()) {
                 free_device_variable(os, "rng" + n.first, VarMode::LOC_DEVICE_INIT_DEVICE);
@@ -1939,7 +2421,16 @@ void genRunner(const NNmodel &model,    //!< Model description
                 free_variable(os, "inSyn" + sg->getPSModelTargetName(), sg->getInSynVarMode());
 
                 if(sg->isDendriticDelayRequired()) {
-                    free_variable(os, "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayVarMode());
+                    if(sg->isSparseDendriticDelayEnabled()) {
+                        os << "for (unsigned int i = 0; i < " << sg->getMaxDendriticDelayTimesteps() << "; i++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "std::vector<std::pair<unsigned int, " << model.getPrecision() << ">>().swap(denDelayQueue" << sg->getPSModelTargetName() << "[i]);" << std::endl;
+                        }
+                    }
+                    else {
+                        free_variable(os, "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayVarMode());
+                    }
                 }
 
                 if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
@@ -1960,13 +2451,30 @@ void genRunner(const NNmodel &model,    //!< Model description
                 free_variable(os, v.first + s.first, s.second.getWUPostVarMode(v.first));
             }
 
+            // Unmap out-of-core arrays
+            // **NOTE** this must happen before the YALE synapse count is reset
+            if (s.second.isOutOfCore()) {
+                const std::string size = (s.second.getMatrixType() & SynapseMatrixConnectivity::YALE)
+                    ? "C" + s.first + ".connN"
+                    : std::to_string((size_t)s.second.getSrcNeuronGroup()->getNumNeurons() * (size_t)s.second.getMaxConnections());
+
+                os << "FileBackedArray::free(C" << s.first << ".ind, " << size << ");" << std::endl;
+                if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+                    for(const auto &v : s.second.getWUModel()->getVars()) {
+                        os << "FileBackedArray::free(" << v.first << s.first << ", " << size << ");" << std::endl;
+                    }
+                }
+            }
+
             if (s.second.getMatrixType() & SynapseMatrixConnectivity::YALE) {
                 os << "C" << s.first << ".connN= 0;" << std::endl;
 
                 free_host_variable(os, "C" + s.first + ".indInG", VarMode::LOC_HOST_DEVICE_INIT_HOST);
                 free_device_variable(os, "indInG" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
 
-                free_host_variable(os, "C" + s.first + ".ind", VarMode::LOC_HOST_DEVICE_INIT_HOST);
+                if (!s.second.isOutOfCore()) {
+                    free_host_variable(os, "C" + s.first + ".ind", VarMode::LOC_HOST_DEVICE_INIT_HOST);
+                }
                 free_device_variable(os, "ind" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
 
                 if (model.isSynapseGroupPostLearningRequired(s.first)) {
@@ -1989,9 +2497,15 @@ void genRunner(const NNmodel &model,    //!< Model description
                 free_host_variable(os, "C" + s.first + ".rowLength", s.second.getSparseConnectivityVarMode());
                 free_device_variable(os, "rowLength" + s.first, s.second.getSparseConnectivityVarMode());
 
-                free_host_variable(os, "C" + s.first + ".ind", s.second.getSparseConnectivityVarMode());
+                if (!s.second.isOutOfCore()) {
+                    free_host_variable(os, "C" + s.first + ".ind", s.second.getSparseConnectivityVarMode());
+                }
                 free_device_variable(os, "ind" + s.first, s.second.getSparseConnectivityVarMode());
 
+                if (s.second.isDeltaEncodingEnabled()) {
+                    os << "freeDeltaIndices(&D" << s.first << ");" << std::endl;
+                }
+
                 if (model.isSynapseGroupPostLearningRequired(s.first)) {
                     free_host_variable(os, "C" + s.first + ".colLength", s.second.getSparseConnectivityVarMode());
                     free_device_variable(os, "colLength" + s.first, s.second.getSparseConnectivityVarMode());
@@ -2009,11 +2523,28 @@ void genRunner(const NNmodel &model,    //!< Model description
                 free_variable(os, "gp" + s.first, s.second.getSparseConnectivityVarMode());
             }
 
-            if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+            if ((s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) && !s.second.isOutOfCore()) {
                 for(const auto &v : s.second.getWUModel()->getVars()) {
                     free_variable(os, v.first + s.first, s.second.getWUVarMode(v.first));
                 }
             }
+
+            if(s.second.isSynapseDynamicsActivityGated()) {
+                free_host_variable(os, "activeRows" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
+                free_host_variable(os, "rowActiveStep" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
+            }
+
+            if(s.second.getSpikePropagationThreads() > 1) {
+                free_host_variable(os, (s.second.isDendriticDelayRequired() ? "denDelayPrivate" : "inSynPrivate") + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
+            }
+
+            if(s.second.isSynapseDynamicsSkipMaskEnabled()) {
+                free_host_variable(os, "synDynMask" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
+            }
+
+            if(s.second.isCacheBlocked() && (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+                free_host_variable(os, "blockRowPos" + s.first, VarMode::LOC_HOST_DEVICE_INIT_HOST);
+            }
         }
     }
     os << std::endl;
@@ -2070,6 +2601,12 @@ void genRunner(const NNmodel &model,    //!< Model description
             // Generate code to advance host-side spike queues
             genHostSpikeQueueAdvance(os, model, localHostID);
 
+            // Start propagating spikes through overlapped synapse groups
+            // **NOTE** calcNeuronsCPU waits for this to complete before updating the neuron groups which depend on it
+            if (model.isPhaseOverlapRequired()) {
+                os << "overlapWorker->start([](){ calcOverlappedSynapsesCPU(t); });" << std::endl;
+            }
+
             if (model.isTimingEnabled()) os << "neuron_timer.startTimer();" << std::endl;
             os << "calcNeuronsCPU(t);" << std::endl;
             if (model.isTimingEnabled()) {
@@ -2397,7 +2934,7 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
                 size_t size = n.second.getNumNeurons() * n.second.getNumDelaySlots();
                 os << "CHECK_CUDA_ERRORS(cudaMemcpy(d_sT" << n.first;
                 os << ", sT" << n.first;
-                os << ", " << size << " * sizeof(" << model.getTimePrecision() << "), cudaMemcpyHostToDevice));" << std::endl;
+                os << ", " << size << " * sizeof(" << n.second.getSpikeTimeType(model.getTimePrecision()) << "), cudaMemcpyHostToDevice));" << std::endl;
 
                 if(spikeTimeVarMode & VarInit::DEVICE) {
                     os << CodeStream::CB(1062);
@@ -2455,8 +2992,8 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
         {
             CodeStream::Scope b(os);
 
-            const unsigned int numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
-            const unsigned int numTrgNeurons = s.second.getTrgNeuronGroup()->getNumNeurons();
+            const size_t numSrcNeurons = (size_t)s.second.getSrcNeuronGroup()->getNumNeurons();
+            const size_t numTrgNeurons = (size_t)s.second.getTrgNeuronGroup()->getNumNeurons();
             if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) { // INDIVIDUALG
                 if (s.second.getMatrixType() & SynapseMatrixConnectivity::DENSE) {
                     os << "const size_t size = " << numSrcNeurons * numTrgNeurons << ";" << std::endl;
@@ -2609,7 +3146,7 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
             if (n.second.isSpikeTimeRequired() && canPushPullVar(n.second.getSpikeTimeVarMode())) {
                 os << "CHECK_CUDA_ERRORS(cudaMemcpy(sT" << n.first;
                 os << ", d_sT" << n.first;
-                os << ", " << "glbSpkCnt" << n.first << "[0] * sizeof(" << model.getTimePrecision() << "), cudaMemcpyDeviceToHost));" << std::endl;
+                os << ", " << "glbSpkCnt" << n.first << "[0] * sizeof(" << n.second.getSpikeTimeType(model.getTimePrecision()) << "), cudaMemcpyDeviceToHost));" << std::endl;
             }
 
         }
@@ -3158,7 +3695,8 @@ void genMakefile(const NNmodel &model, //!< Model description
     // Start with correct NVCC flags to build shared library or object file as appropriate
     // **NOTE** -c = compile and assemble, don't link
     string cxxFlags = GENN_PREFERENCES::buildSharedLibrary ? "-shared -fPIC" : "-c";
-    cxxFlags += " -DCPU_ONLY -std=c++11 -MMD -MP";
+    // **NOTE** runner.cc and sparseUtils.cc may use std::thread so always build with pthreads
+    cxxFlags += " -DCPU_ONLY -std=c++11 -pthread -MMD -MP";
     cxxFlags += " " + GENN_PREFERENCES::userCxxFlagsGNU;
     if (GENN_PREFERENCES::optimizeCode) {
         cxxFlags += " -O3 -ffast-math";
@@ -3170,6 +3708,33 @@ void genMakefile(const NNmodel &model, //!< Model description
     os << endl;
     os << "CXXFLAGS       :=" << cxxFlags << endl;
     os << endl;
+
+    // Add build optimisation modes
+    // **NOTE** LTO objects are built 'fat' so they can still be linked into executables built without LTO
+    os << "# Build optimisation - profile-guided optimisation is performed by building with PGO=generate," << endl;
+    os << "# running a representative simulation and then rebuilding with PGO=use" << endl;
+    if(GENN_PREFERENCES::nativeCode) {
+        os << "NATIVE         ?=1" << endl;
+    }
+    if(GENN_PREFERENCES::linkTimeOptimisation) {
+        os << "LTO            ?=1" << endl;
+    }
+    if(!GENN_PREFERENCES::profileGuidedOptimisation.empty()) {
+        os << "PGO            ?=" << GENN_PREFERENCES::profileGuidedOptimisation << endl;
+    }
+    os << "PGO_PATH       :=$(CURDIR)/pgo" << endl;
+    os << "ifeq ($(NATIVE),1)" << endl;
+    os << "    CXXFLAGS   +=-march=native" << endl;
+    os << "endif" << endl;
+    os << "ifeq ($(LTO),1)" << endl;
+    os << "    CXXFLAGS   +=-flto -ffat-lto-objects" << endl;
+    os << "endif" << endl;
+    os << "ifeq ($(PGO),generate)" << endl;
+    os << "    CXXFLAGS   +=-fprofile-generate=\"$(PGO_PATH)\"" << endl;
+    os << "else ifeq ($(PGO),use)" << endl;
+    os << "    CXXFLAGS   +=-fprofile-use=\"$(PGO_PATH)\" -fprofile-correction" << endl;
+    os << "endif" << endl;
+    os << endl;
 #ifdef MPI_ENABLE
     os << "INCLUDEFLAGS   =-I\"$(GENN_PATH)/lib/include\" -I\"$(MPI_PATH)/include\"" << endl;
 #else
@@ -3210,6 +3775,7 @@ void genMakefile(const NNmodel &model, //!< Model description
     // Build NVCC compile flags string
     string nvccFlags = "-std=c++11 -x cu -arch sm_";
     nvccFlags += to_string(deviceProp[theDevice].major) + to_string(deviceProp[theDevice].minor);
+    nvccFlags += " -Xcompiler \"-pthread\"";
     nvccFlags += " " + GENN_PREFERENCES::userNvccFlags;
     if (GENN_PREFERENCES::optimizeCode) {
         nvccFlags += " -O3 -use_fast_math -Xcompiler \"-ffast-math\"";
@@ -36,6 +36,9 @@ namespace GENN_PREFERENCES {
     bool autoChooseDevice= true; //!< Flag to signal whether the GPU device should be chosen automatically
     bool optimizeCode = false; //!< Request speed-optimized code, at the expense of floating-point accuracy
     bool debugCode = false; //!< Request debug data to be embedded in the generated code
+    bool nativeCode = false; //!< Request CPU code tuned for the instruction set of the host processor (used for unix based platforms)
+    bool linkTimeOptimisation = false; //!< Request link-time optimisation of the CPU code (used for unix based platforms)
+    std::string profileGuidedOptimisation = ""; //!< Profile-guided optimisation mode of the CPU code - "generate" to record a profile, "use" to build with it or empty to disable (used for unix based platforms)
     bool showPtxInfo = false; //!< Request that PTX assembler information be displayed for each CUDA kernel during compilation
     bool buildSharedLibrary = false;   //!< Should generated code and Makefile build into a shared library e.g. for use in SpineML simulator
     bool autoInitSparseVars = false; //!< Previously, variables associated with sparse synapse populations were not automatically initialised. If this flag is set this now occurs in the initMODEL_NAME function and copyStateToDevice is deferred until here
@@ -55,6 +58,8 @@ namespace GENN_PREFERENCES {
     std::string userCxxFlagsWIN = ""; //!< Allows users to set specific C++ compiler options they may want to use for all host side code (used for windows platforms)
     std::string userCxxFlagsGNU = ""; //!< Allows users to set specific C++ compiler options they may want to use for all host side code (used for unix based platforms)
     std::string userNvccFlags = ""; //!< Allows users to set specific nvcc compiler options they may want to use for all GPU code (identical for windows and unix platforms)
+    std::string buildCacheDirectory = ""; //!< Directory in which build_model_runner caches compiled models - if empty, the directory containing the generated code is used
+    std::string outOfCoreDirectory = ""; //!< Directory in which the files backing out-of-core synapse groups are created - if empty, the working directory of the simulation is used
 };
 
 // These will eventually go inside e.g. some HardwareConfig class. Putting them here meanwhile.
@@ -1,7 +1,66 @@
 #include "initSparseConnectivitySnippet.h"
 
+// Standard C++ includes
+#include <algorithm>
+
 // Implement sparse connectivity initialization snippets
 IMPLEMENT_SNIPPET(InitSparseConnectivitySnippet::Uninitialised);
 IMPLEMENT_SNIPPET(InitSparseConnectivitySnippet::OneToOne);
 IMPLEMENT_SNIPPET(InitSparseConnectivitySnippet::FixedProbability);
-IMPLEMENT_SNIPPET(InitSparseConnectivitySnippet::FixedProbabilityNoAutapse);
\ No newline at end of file
+IMPLEMENT_SNIPPET(InitSparseConnectivitySnippet::FixedProbabilityNoAutapse);
+IMPLEMENT_SNIPPET(InitSparseConnectivitySnippet::FixedNumberPostWithReplacement);
+IMPLEMENT_SNIPPET(InitSparseConnectivitySnippet::FixedNumberTotalWithReplacement);
+IMPLEMENT_SNIPPET(InitSparseConnectivitySnippet::SpatialGaussian2D);
+IMPLEMENT_SNIPPET(InitSparseConnectivitySnippet::SpatialGaussian3D);
+
+//----------------------------------------------------------------------------
+// InitSparseConnectivitySnippet
+//----------------------------------------------------------------------------
+unsigned int InitSparseConnectivitySnippet::calcMaxGridNeighbours(unsigned int numSrc, unsigned int srcWidth, unsigned int srcHeight, double srcSpacing,
+                                                                  unsigned int numTrg, unsigned int trgWidth, unsigned int trgHeight, double trgSpacing,
+                                                                  double maxDistance)
+{
+    // **NOTE** distances are compared with a little tolerance so that rounding
+    // in single-precision generated code can never produce more synapses than this
+    const double maxDistanceSq = maxDistance * maxDistance * (1.0 + 1E-5);
+    const unsigned int srcLayerSize = srcWidth * srcHeight;
+    const unsigned int trgLayerSize = trgWidth * trgHeight;
+    const int trgDepth = (int)((numTrg + trgLayerSize - 1) / trgLayerSize);
+
+    // Get range of target grid coordinates which lie within maxDistance of a position
+    auto getRange =
+        [maxDistance, trgSpacing](double pos, int size)
+        {
+            const int min = std::max(0, (int)std::ceil(((pos - maxDistance) / trgSpacing) - 1E-5));
+            const int max = std::min(size - 1, (int)std::floor(((pos + maxDistance) / trgSpacing) + 1E-5));
+            return std::make_pair(min, max);
+        };
+
+    unsigned int maxNeighbours = 0;
+    for(unsigned int i = 0; i < numSrc; i++) {
+        const double srcX = (double)(i % srcWidth) * srcSpacing;
+        const double srcY = (double)((i % srcLayerSize) / srcWidth) * srcSpacing;
+        const double srcZ = (double)(i / srcLayerSize) * srcSpacing;
+
+        // Count target neurons within maxDistance, only considering the block of the target grid surrounding the source neuron
+        const auto xRange = getRange(srcX, (int)trgWidth);
+        const auto yRange = getRange(srcY, (int)trgHeight);
+        const auto zRange = getRange(srcZ, trgDepth);
+        unsigned int neighbours = 0;
+        for(int z = zRange.first; z <= zRange.second; z++) {
+            for(int y = yRange.first; y <= yRange.second; y++) {
+                for(int x = xRange.first; x <= xRange.second; x++) {
+                    const unsigned int j = (z * trgLayerSize) + (y * trgWidth) + x;
+                    const double dX = ((double)x * trgSpacing) - srcX;
+                    const double dY = ((double)y * trgSpacing) - srcY;
+                    const double dZ = ((double)z * trgSpacing) - srcZ;
+                    if(j < numTrg && ((dX * dX) + (dY * dY) + (dZ * dZ)) <= maxDistanceSq) {
+                        neighbours++;
+                    }
+                }
+            }
+        }
+        maxNeighbours = std::max(maxNeighbours, neighbours);
+    }
+    return maxNeighbours;
+}
@@ -18,7 +18,10 @@
 
 // Standard C++ includes
 #include <algorithm>
+#include <iostream>
 #include <numeric>
+#include <regex>
+#include <set>
 #include <typeinfo>
 
 // Standard C includes
@@ -59,6 +62,26 @@ void createVarInitialiserFromLegacyVars(const std::vector<double> &ini, std::vec
                        return NewModels::VarInit(v);
                    });
 }
+
+//! Is the variable \p name assigned to anywhere in \p code
+bool isVarWritten(const std::string &code, const std::string &name)
+{
+    const std::string var = "\\$\\(" + name + "\\)";
+    const std::regex assignment(var + "\\s*([-+*/%&|^]|<<|>>)?=(?!=)|" + var + "\\s*(\\+\\+|--)|(\\+\\+|--)\\s*" + var);
+    return std::regex_search(code, assignment);
+}
+
+std::string getMatrixConnectivityName(SynapseMatrixConnectivity connectivity)
+{
+    switch(connectivity) {
+    case SynapseMatrixConnectivity::DENSE:
+        return "DENSE";
+    case SynapseMatrixConnectivity::BITMASK:
+        return "BITMASK";
+    default:
+        return "RAGGED";
+    }
+}
 }
 
 // ------------------------------------------------------------------------
@@ -71,6 +94,7 @@ NNmodel::NNmodel() : m_TimePrecision(TimePrecision::DEFAULT), RNtype{"uint64_t"}
     setDT(0.5);
     setPrecision(GENN_FLOAT);
     setTiming(false);
+    setPhaseOverlap(false);
 #ifndef CPU_ONLY
     setGPUDevice(AUTODEVICE);
 #endif
@@ -195,11 +219,61 @@ bool NNmodel::canRunOnCPU() const
     return true;
 }
 
+bool NNmodel::isSynapseGroupOverlapped(const SynapseGroup &sg) const
+{
+    if(!phaseOverlap) {
+        return false;
+    }
+
+    // **NOTE** postsynaptic learning would be reordered with respect to the overlapped spike propagation
+    // and the host RNG is shared with the neuron update so can't be used from the worker thread
+    const auto *wu = sg.getWUModel();
+    return ((sg.getDelaySteps() > 0) && wu->getLearnPostCode().empty()
+            && !::isRNGRequired(wu->getSimCode()) && !::isRNGRequired(wu->getEventCode())
+            && !::isRNGRequired(wu->getEventThresholdConditionCode()));
+}
+
+bool NNmodel::isNeuronGroupOverlapBlocked(const NeuronGroup &ng) const
+{
+    // Neuron groups can't be updated while overlapped synapse groups are adding input to them or reading their variables
+    if(std::any_of(ng.getInSyn().cbegin(), ng.getInSyn().cend(),
+        [this](const SynapseGroup *sg){ return isSynapseGroupOverlapped(*sg); }))
+    {
+        return true;
+    }
+
+    // Or, while overlapped outgoing synapse groups are reading their spikes, if the update
+    // will overwrite the delay slot being read or the variables of the weight update model
+    return std::any_of(ng.getOutSyn().cbegin(), ng.getOutSyn().cend(),
+        [this, &ng](const SynapseGroup *sg)
+        {
+            return (isSynapseGroupOverlapped(*sg)
+                    && ((ng.getNumDelaySlots() <= (sg->getDelaySteps() + 1)) || ng.isSpikeTimeRequired()
+                        || !sg->getWUModel()->getPreVars().empty()));
+        });
+}
+
+bool NNmodel::isPhaseOverlapRequired() const
+{
+    return std::any_of(std::begin(m_LocalSynapseGroups), std::end(m_LocalSynapseGroups),
+        [this](const NNmodel::SynapseGroupValueType &s){ return isSynapseGroupOverlapped(s.second); });
+}
+
+unsigned int NNmodel::getMaxSpikePropagationThreads() const
+{
+    unsigned int maxThreads = 1;
+    for(const auto &s : m_LocalSynapseGroups) {
+        maxThreads = std::max(maxThreads, s.second.getSpikePropagationThreads());
+    }
+    return maxThreads;
+}
+
 std::string NNmodel::getTimePrecision() const
 {
     // If time precision is set to match model precision
+    // **NOTE** time would quickly saturate a fixed-point type so double precision is used instead
     if(m_TimePrecision == TimePrecision::DEFAULT) {
-        return getPrecision();
+        return isFixedPointPrecision() ? "double" : getPrecision();
     }
     // Otherwise return appropriate type
     else if(m_TimePrecision == TimePrecision::FLOAT) {
@@ -806,6 +880,97 @@ void NNmodel::setSpanTypeToPre(const string &sname /**< name of the synapse grou
 }
 
 
+//--------------------------------------------------------------------------
+/*! \brief This function chooses the representation of a synapse group added with SynapseMatrixType::AUTO.
+
+Weight update model variables are shared between synapses (GLOBALG) if they are all initialised to
+constants and never assigned to by the weight update model. Connectivity is stored as a BITMASK if
+weights are shared, the model is static and a row of the bitmask is at least 4 times smaller than the
+estimated longest RAGGED row - bitmask rows are scanned one postsynaptic neuron at a time - or as RAGGED.
+Without a connectivity initialiser, GeNN cannot tell all-to-all connectivity from connectivity the user
+will fill in, so the matrix type must be given explicitly.
+ */
+//--------------------------------------------------------------------------
+
+SynapseMatrixType NNmodel::chooseSynapseMatrixType(const std::string &name, const WeightUpdateModels::Base *wum, const std::vector<NewModels::VarInit> &wuVarInitialisers,
+                                                   const PostsynapticModels::Base *psm, const NeuronGroup *srcNeuronGroup, const NeuronGroup *trgNeuronGroup,
+                                                   const InitSparseConnectivitySnippet::Init &connectivityInitialiser) const
+{
+    const unsigned int numPre = srcNeuronGroup->getNumNeurons();
+    const unsigned int numPost = trgNeuronGroup->getNumNeurons();
+
+    const auto *connectivitySnippet = connectivityInitialiser.getSnippet();
+    if(dynamic_cast<const InitSparseConnectivitySnippet::Uninitialised*>(connectivitySnippet) != nullptr) {
+        gennError("Synapse group '" + name + "' has no connectivity initialiser so SynapseMatrixType::AUTO cannot choose its representation. "
+                  "Use a DENSE matrix type for all-to-all connectivity or a SPARSE, RAGGED or BITMASK type with setMaxConnections for connectivity loaded by user code.");
+    }
+
+    // Determine whether weight update model variables can be shared between all synapses
+    const std::string wuCode = wum->getSimCode() + wum->getEventCode() + wum->getLearnPostCode() + wum->getSynapseDynamicsCode();
+    const auto wuVars = wum->getVars();
+    bool global = true;
+    size_t varBytes = 0;
+    for(size_t i = 0; i < wuVars.size(); i++) {
+        if(dynamic_cast<const InitVarSnippet::Constant*>(wuVarInitialisers[i].getSnippet()) == nullptr
+            || isVarWritten(wuCode, wuVars[i].first))
+        {
+            global = false;
+        }
+        varBytes += theSize((wuVars[i].second == "scalar") ? ftype : wuVars[i].second);
+    }
+    if(global) {
+        varBytes = 0;
+    }
+
+    // Postsynaptic learning and synapse dynamics require connectivity which can be iterated through
+    const bool plastic = !wum->getLearnPostCode().empty() || !wum->getSynapseDynamicsCode().empty();
+
+    // Estimate length of longest row
+    const auto calcMaxRowLengthFunc = connectivitySnippet->getCalcMaxRowLengthFunc();
+    const unsigned int maxRowLength = calcMaxRowLengthFunc
+        ? std::min(numPost, calcMaxRowLengthFunc(numPre, numPost, connectivityInitialiser.getParams()))
+        : numPost;
+
+    // Estimate bytes of connectivity and weights read per presynaptic spike in each representation
+    const double bitmaskRowBytes = std::ceil((double)numPost / 32.0) * sizeof(uint32_t);
+    const double raggedRowBytes = (double)maxRowLength * (sizeof(unsigned int) + varBytes);
+
+    SynapseMatrixConnectivity connectivity;
+    double rowBytes;
+    double memBytes;
+    if(global && !plastic && (bitmaskRowBytes * 4.0) <= raggedRowBytes) {
+        connectivity = SynapseMatrixConnectivity::BITMASK;
+        rowBytes = bitmaskRowBytes;
+        memBytes = bitmaskRowBytes * numPre;
+    }
+    else {
+        connectivity = SynapseMatrixConnectivity::RAGGED;
+        rowBytes = raggedRowBytes;
+        memBytes = (raggedRowBytes + sizeof(unsigned int)) * numPre;
+    }
+
+    // Every synapse in the row also reads and writes the input of its postsynaptic neuron
+    // **NOTE** this is the same in both representations so it doesn't affect the choice
+    rowBytes += (double)maxRowLength * 2.0 * theSize(ftype);
+
+    // Postsynaptic model state is only shared if there is none
+    const bool individualPSM = !psm->getVars().empty();
+
+    SynapseMatrixType mtype;
+    if(connectivity == SynapseMatrixConnectivity::BITMASK) {
+        mtype = individualPSM ? SynapseMatrixType::BITMASK_GLOBALG_INDIVIDUAL_PSM : SynapseMatrixType::BITMASK_GLOBALG;
+    }
+    else {
+        mtype = !global ? SynapseMatrixType::RAGGED_INDIVIDUALG
+            : (individualPSM ? SynapseMatrixType::RAGGED_GLOBALG_INDIVIDUAL_PSM : SynapseMatrixType::RAGGED_GLOBALG);
+    }
+
+    std::cout << "Synapse group '" << name << "' uses " << getMatrixConnectivityName(connectivity) << (global ? "_GLOBALG" : "_INDIVIDUALG");
+    std::cout << " connectivity: estimated " << memBytes / (1024.0 * 1024.0) << " MB of connectivity and weights, ";
+    std::cout << rowBytes << " bytes of connectivity, weights and postsynaptic input accessed per presynaptic spike (max row length " << maxRowLength << ")" << std::endl;
+    return mtype;
+}
+
 //--------------------------------------------------------------------------
 /*! \brief This functions sets the global value of the maximal synaptic conductance for a synapse population that was idfentified as conductance specifcation method "GLOBALG" 
  */
@@ -864,6 +1029,13 @@ void NNmodel::setPrecision(FloatType floattype /**<  */)
     case GENN_LONG_DOUBLE:
         ftype = "long double"; // not supported by CUDA at the moment.
         break;
+    case GENN_FIXED_Q16_16:
+#ifdef CPU_ONLY
+        ftype = "FixedPoint<16>";
+#else
+        gennError("Fixed-point precision is only supported in CPU_ONLY mode.");
+#endif
+        break;
     default:
         gennError("Unrecognised floating-point type.");
     }
@@ -891,6 +1063,19 @@ void NNmodel::setTiming(bool theTiming /**<  */)
     timing= theTiming;
 }
 
+//--------------------------------------------------------------------------
+/*! \brief This function sets a flag to determine whether spike propagation through synapse groups with axonal delays is run on a worker thread concurrently with the update of the neuron groups which don't depend on it.
+ */
+//--------------------------------------------------------------------------
+
+void NNmodel::setPhaseOverlap(bool overlap)
+{
+    if (final) {
+        gennError("Trying to set phase overlap flag in a finalized model.");
+    }
+    phaseOverlap = overlap;
+}
+
 
 //--------------------------------------------------------------------------
 /*! \brief This function sets the random seed. If the passed argument is > 0, automatic seeding is disabled. If the argument is 0, the underlying seed is obtained from the time() function.
@@ -938,6 +1123,11 @@ void NNmodel::setGPUDevice(int device)
 #endif
 
 
+bool NNmodel::isFixedPointPrecision() const
+{
+    return isFixedPointType(ftype);
+}
+
 string NNmodel::scalarExpr(const double val) const
 {
     string tmp;
@@ -948,6 +1138,9 @@ string NNmodel::scalarExpr(const double val) const
     if (ftype == "double") {
         tmp= to_string(val);
     }
+    if (isFixedPointPrecision()) {
+        tmp= writePreciseString(val);
+    }
     return tmp;
 }
 
@@ -1008,6 +1201,12 @@ void NNmodel::finalize()
         for(auto *sg : n.second.getOutSyn()) {
             const auto *wu = sg->getWUModel();
 
+            // Give overlapped synapse groups a spare delay slot so the neuron
+            // update can write spikes while they are still reading their own
+            if (isSynapseGroupOverlapped(*sg)) {
+                n.second.checkNumDelaySlots(sg->getDelaySteps() + 1);
+            }
+
             if (!wu->getEventCode().empty()) {
                 sg->setSpikeEventRequired(true);
                 n.second.setSpikeEventRequired(true);
@@ -1019,8 +1218,9 @@ void NNmodel::finalize()
 
                 // do an early replacement of parameters, derived parameters and extraglobalsynapse parameters
                 string eCode = wu->getEventThresholdConditionCode();
-                value_substitutions(eCode, wu->getParamNames(), sg->getWUParams());
-                value_substitutions(eCode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams());
+                param_substitutions(eCode, wu->getParamNames(), sg->getWUParams(), sg->getWUParamDynamic(), sg->getName());
+                param_substitutions(eCode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams(),
+                                    sg->getWUDerivedParamDynamic(), sg->getName());
                 name_substitutions(eCode, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg->getName());
 
                 // Add code and name of
@@ -1046,7 +1246,12 @@ void NNmodel::finalize()
     // NEURON GROUPS
     for(auto &n : m_LocalNeuronGroups) {
         // Initialize derived parameters
-        n.second.initDerivedParams(dt);
+        // **NOTE** current sources are evaluated as part of their target neuron group's update so share its timestep
+        const double updateDT = dt * n.second.getUpdateInterval();
+        n.second.initDerivedParams(updateDT);
+        for(auto *cs : n.second.getCurrentSources()) {
+            cs->initDerivedParams(updateDT);
+        }
 
         // Make extra global parameter lists
         n.second.addExtraGlobalParams(neuronKernelParameters);
@@ -1078,6 +1283,11 @@ void NNmodel::finalize()
         if (!wu->getSynapseDynamicsCode().empty()) {
             s.second.getSrcNeuronGroup()->updatePreVarQueues(wu->getSynapseDynamicsCode());
             s.second.getTrgNeuronGroup()->updatePostVarQueues(wu->getSynapseDynamicsCode());
+
+            // If synapse dynamics are gated by presynaptic activity, active rows are found from source neuron spikes
+            if (s.second.isSynapseDynamicsActivityGated()) {
+                s.second.getSrcNeuronGroup()->setTrueSpikeRequired(true);
+            }
         }
 
         // Make extra global parameter lists
@@ -1087,6 +1297,13 @@ void NNmodel::finalize()
         s.second.addExtraGlobalPostLearnParams(simLearnPostKernelParameters);
         s.second.addExtraGlobalSynapseDynamicsParams(synapseDynamicsKernelParameters);
 
+        // Connectivity snippets which share state between rows rely on rows being built in order on the host
+        if(s.second.isDeviceSparseConnectivityInitRequired()
+            && !s.second.getConnectivityInitialiser().getSnippet()->getSharedRowBuildStateVars().empty())
+        {
+            gennError("Sparse connectivity of synapse population '" + s.first + "' uses a connectivity initialisation snippet which can only be initialised on the host");
+        }
+
         // If this synapse group has either ragged or bitmask connectivity which is initialised
         // using a connectivity snippet AND has individual synaptic variables
         if(((s.second.getMatrixType() & SynapseMatrixConnectivity::RAGGED)
@@ -1102,17 +1319,48 @@ void NNmodel::finalize()
                 }
             }
         }
+
+        // Codebooks can only represent their fixed set of values so variables stored in them must not be updated
+        const std::string wuCode = wu->getSimCode() + wu->getEventCode() + wu->getLearnPostCode() + wu->getSynapseDynamicsCode();
+        for(const auto &v : wu->getVars()) {
+            if(s.second.getWUVarStorageType(v.first) == VarStorageType::CODEBOOK8 && isVarWritten(wuCode, v.first)) {
+                gennError("Weight update model variable '" + v.first + "' of synapse population '" + s.first + "' is stored in a codebook but is assigned to by the weight update model");
+            }
+        }
     }
 
     // CURRENT SOURCES
     for(auto &cs : m_LocalCurrentSources) {
-        // Initialize derived parameters
-        cs.second.initDerivedParams(dt);
-
         // Make extra global parameter lists
         cs.second.addExtraGlobalParams(currentSourceKernelParameters);
     }
 
+    // Pass variables holding parameters which can be changed at runtime to any kernel which might reference them
+    // **NOTE** neuron parameters can be referenced from synaptic code and weight update model parameters from spike event conditions
+    std::set<std::string> dynamicParamNames;
+    auto addDynamicParamKernelParameters =
+        [this, &dynamicParamNames](const std::string &groupName, const std::vector<std::pair<std::string, double>> &dynamicParamValues)
+        {
+            for(const auto &p : dynamicParamValues) {
+                // **NOTE** variables are named by appending the group name to the parameter name so, for example,
+                // weight update and postsynaptic model parameters with the same name would share a variable
+                if(!dynamicParamNames.insert(p.first).second) {
+                    gennError("Variable '" + p.first + "' used to store a parameter of '" + groupName + "' which can be changed at runtime is already used by another parameter");
+                }
+
+                neuronKernelParameters.emplace(p.first, "scalar");
+                synapseKernelParameters.emplace(p.first, "scalar");
+                simLearnPostKernelParameters.emplace(p.first, "scalar");
+                synapseDynamicsKernelParameters.emplace(p.first, "scalar");
+            }
+        };
+    for(const auto &n : m_LocalNeuronGroups) {
+        addDynamicParamKernelParameters(n.first, n.second.getDynamicParamValues());
+    }
+    for(const auto &s : m_LocalSynapseGroups) {
+        addDynamicParamKernelParameters(s.first, s.second.getDynamicParamValues());
+    }
+
     // Merge incoming postsynaptic models
     for(auto &n : m_LocalNeuronGroups) {
         if(!n.second.getInSyn().empty()) {
@@ -1120,15 +1368,123 @@ void NNmodel::finalize()
         }
     }
 
-    // CURRENT SOURCES
-    for(auto &cs : m_LocalCurrentSources) {
-        // Initialize derived parameters
-        cs.second.initDerivedParams(dt);
+    // Check that neurons in groups using active-set updates can be skipped based solely on their state and input
+    for(const auto &n : m_LocalNeuronGroups) {
+        if(n.second.isActiveSetUpdateEnabled()) {
+            if(n.second.isDelayRequired()) {
+                gennError("Neuron population '" + n.first + "' uses active-set updates so cannot have delayed outputs");
+            }
+            if(n.second.isSpikeEventRequired()) {
+                gennError("Neuron population '" + n.first + "' uses active-set updates so cannot emit spike-like events");
+            }
+            for(const auto &m : n.second.getMergedInSyn()) {
+                if((m.first->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) && !m.first->getPSModel()->getVars().empty()) {
+                    gennError("Neuron population '" + n.first + "' uses active-set updates so incoming postsynaptic models cannot have state variables");
+                }
+            }
+            for(const auto *sg : n.second.getInSyn()) {
+                if(sg->getSpikePropagationThreads() > 1) {
+                    gennError("Neuron population '" + n.first + "' uses active-set updates so spike propagation through incoming synapse group '" + sg->getName() + "' cannot be split between threads");
+                }
+            }
+        }
+    }
 
-        // Make extra global parameter lists
-        cs.second.addExtraGlobalParams(currentSourceKernelParameters);
+    // Check that threads propagating spikes through a synapse group can only race on the inSyn buffers they have private copies of
+    for(const auto &s : m_LocalSynapseGroups) {
+        if(s.second.getSpikePropagationThreads() > 1) {
+            const auto *wu = s.second.getWUModel();
+            if(s.second.isSpikeEventRequired()) {
+                gennError("Synapse group '" + s.first + "' processes spike-like events so its spike propagation cannot be split between threads");
+            }
+            if(!wu->getPostVars().empty()) {
+                gennError("Synapse group '" + s.first + "' has postsynaptic weight update model variables so its spike propagation cannot be split between threads");
+            }
+            if(::isRNGRequired(wu->getSimCode())) {
+                gennError("Synapse group '" + s.first + "' generates random numbers so its spike propagation cannot be split between threads");
+            }
+            if(s.second.isDendriticDelayRequired() && s.second.isSparseDendriticDelayEnabled()) {
+                gennError("Synapse group '" + s.first + "' uses sparse dendritic delays so its spike propagation cannot be split between threads");
+            }
+        }
+    }
+
+    // Check that delta-encoded connectivity is only used with the standard row-wise spike propagation
+    for(const auto &s : m_LocalSynapseGroups) {
+        if(s.second.isDeltaEncodingEnabled()) {
+            if(s.second.getCacheBlockSize() > 0) {
+                gennError("Synapse group '" + s.first + "' uses delta-encoded connectivity so cannot be cache blocked");
+            }
+            if(s.second.isOutOfCore()) {
+                gennError("Synapse group '" + s.first + "' uses delta-encoded connectivity so cannot be stored out-of-core");
+            }
+        }
+    }
+
+    // Check that neuron groups which are updated less often than every timestep never have their state read from delay queues
+    for(const auto &n : m_LocalNeuronGroups) {
+        if(n.second.getUpdateInterval() > 1) {
+#ifndef CPU_ONLY
+            gennError("Neuron population '" + n.first + "' has an update interval but these are only supported in CPU_ONLY mode");
+#endif
+            if(n.second.isDelayRequired()) {
+                const auto vars = n.second.getNeuronModel()->getVars();
+                for(size_t i = 0; i < vars.size(); i++) {
+                    if(n.second.isVarQueueRequired(i)) {
+                        gennError("Neuron population '" + n.first + "' has an update interval so variable '" + vars[i].first + "' cannot be read with delay");
+                    }
+                }
+                for(const auto *sg : n.second.getOutSyn()) {
+                    if(!sg->getWUModel()->getPreVars().empty()) {
+                        gennError("Neuron population '" + n.first + "' has an update interval and delayed outputs so outgoing synapse group '" + sg->getName() + "' cannot have presynaptic variables");
+                    }
+                }
+                for(const auto *sg : n.second.getInSyn()) {
+                    if(!sg->getWUModel()->getPostVars().empty()) {
+                        gennError("Neuron population '" + n.first + "' has an update interval and delayed outputs so incoming synapse group '" + sg->getName() + "' cannot have postsynaptic variables");
+                    }
+                }
+            }
+        }
     }
 
+#ifndef CPU_ONLY
+    for(const auto &n : m_LocalNeuronGroups) {
+        if(n.second.isVersionedDelayQueuesEnabled()) {
+            gennError("Neuron population '" + n.first + "' uses versioned delay queues but these are only supported in CPU_ONLY mode");
+        }
+        if(n.second.isCompactSpikeTimesEnabled()) {
+            gennError("Neuron population '" + n.first + "' uses compact spike times but these are only supported in CPU_ONLY mode");
+        }
+    }
+    for(const auto &s : m_LocalSynapseGroups) {
+        if(s.second.getSynapseDynamicsUpdateInterval() > 1) {
+            gennError("Synapse group '" + s.first + "' has a synapse dynamics update interval but these are only supported in CPU_ONLY mode");
+        }
+        if(s.second.isSynapseDynamicsSkipMaskEnabled()) {
+            gennError("Synapse group '" + s.first + "' has a synapse dynamics skip mask but these are only supported in CPU_ONLY mode");
+        }
+        if(s.second.isOutOfCore()) {
+            gennError("Synapse group '" + s.first + "' is stored out-of-core but this is only supported in CPU_ONLY mode");
+        }
+        if(s.second.isDeltaEncodingEnabled()) {
+            gennError("Synapse group '" + s.first + "' uses delta-encoded connectivity but this is only supported in CPU_ONLY mode");
+        }
+        if(s.second.isSparseDendriticDelayEnabled()) {
+            gennError("Synapse group '" + s.first + "' uses sparse dendritic delays but these are only supported in CPU_ONLY mode");
+        }
+        if(s.second.getSpikePropagationThreads() > 1) {
+            gennError("Synapse group '" + s.first + "' propagates spikes on multiple threads but this is only supported in CPU_ONLY mode");
+        }
+    }
+#elif defined(_WIN32)
+    for(const auto &s : m_LocalSynapseGroups) {
+        if(s.second.isOutOfCore()) {
+            gennError("Synapse group '" + s.first + "' is stored out-of-core but this is only supported on POSIX systems");
+        }
+    }
+#endif
+
     setPopulationSums();
 
 #ifndef CPU_ONLY
@@ -37,6 +37,45 @@ void NeuronGroup::setVarMode(const std::string &varName, VarMode mode)
     m_VarMode[getNeuronModel()->getVarIndex(varName)] = mode;
 }
 
+void NeuronGroup::setActiveSetUpdateEnabled(bool enabled)
+{
+    if (enabled && getNeuronModel()->getRestConditionCode().empty()) {
+        gennError("setActiveSetUpdateEnabled: Neuron model used by population '" + getName() + "' does not provide a rest condition.");
+    }
+
+    m_ActiveSetUpdateEnabled = enabled;
+}
+
+void NeuronGroup::setUpdateInterval(unsigned int timesteps)
+{
+    if (timesteps == 0) {
+        gennError("setUpdateInterval: Neuron population '" + getName() + "' update interval must be at least one timestep.");
+    }
+
+    m_UpdateInterval = timesteps;
+}
+
+void NeuronGroup::setParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_ParamDynamic[getNeuronModel()->getParamIndex(paramName)] = dynamic;
+}
+
+void NeuronGroup::setFunctionTable(const std::string &functionName, double min, double max, unsigned int numIntervals,
+                                   FunctionTable::Interpolation interpolation)
+{
+    setFunctionTable(functionName, FunctionTable::getMathsFunction(functionName), min, max, numIntervals, interpolation);
+}
+
+void NeuronGroup::setFunctionTable(const std::string &functionName, std::function<double(double)> function, double min, double max,
+                                   unsigned int numIntervals, FunctionTable::Interpolation interpolation)
+{
+    // Replace any existing table for this function
+    m_FunctionTables.erase(std::remove_if(m_FunctionTables.begin(), m_FunctionTables.end(),
+                                          [&functionName](const FunctionTable &f){ return (f.getFunctionName() == functionName); }),
+                           m_FunctionTables.end());
+    m_FunctionTables.emplace_back(functionName, function, min, max, numIntervals, interpolation);
+}
+
 VarMode NeuronGroup::getVarMode(const std::string &varName) const
 {
     return m_VarMode[getNeuronModel()->getVarIndex(varName)];
@@ -59,6 +98,10 @@ void NeuronGroup::initDerivedParams(double dt)
         m_DerivedParams.push_back(d.second(m_Params, dt));
     }
 
+    // Derived parameters calculated from any parameters which can change at runtime must also be stored in variables
+    m_DerivedParamDependencies = NeuronModels::Base::getDerivedParamDependencies(derivedParams, m_Params, m_ParamDynamic, dt);
+    m_DerivedParamDynamic = NeuronModels::Base::getDynamicDerivedParams(m_DerivedParamDependencies, derivedParams.size());
+
     // Initialise derived parameters for variable initialisers
     for(auto &v : m_VarInitialisers) {
         v.initDerivedParams(dt);
@@ -108,6 +151,11 @@ void NeuronGroup::mergeIncomingPSM()
         if(!a->getPSVarInitialisers().empty()) {
             continue;
         }
+
+        // Continue if any parameters are stored in variables as these are specific to each synapse group
+        if(a->isPSParamDynamicRequired()) {
+            continue;
+        }
         
         // Create a name for mmerged
         const std::string mergedPSMName = "Merged" + std::to_string(i) + "_" + getName();
@@ -126,6 +174,8 @@ void NeuronGroup::mergeIncomingPSM()
             if(typeid((*b)->getPSModel()).hash_code() == aModelTypeHash
                 && a->getInSynVarMode() == (*b)->getInSynVarMode()
                 && a->getMaxDendriticDelayTimesteps() == (*b)->getMaxDendriticDelayTimesteps()
+                && a->isSparseDendriticDelayEnabled() == (*b)->isSparseDendriticDelayEnabled()
+                && !(*b)->isPSParamDynamicRequired()
                 && std::equal(aParamsBegin, aParamsEnd, (*b)->getPSParams().cbegin())
                 && std::equal(aDerivedParamsBegin, aDerivedParamsEnd, (*b)->getPSDerivedParams().cbegin()))
             {
@@ -203,6 +253,28 @@ void NeuronGroup::addExtraGlobalParams(std::map<string, string> &kernelParameter
     }
 }
 
+std::vector<std::pair<std::string, double>> NeuronGroup::getDynamicParamValues() const
+{
+    DerivedParamNameIterCtx nmDerivedParams(getNeuronModel()->getDerivedParams());
+    const auto paramNames = getNeuronModel()->getParamNames();
+
+    std::vector<std::pair<std::string, double>> dynamicParamValues;
+    addDynamicParamValues(dynamicParamValues, paramNames.cbegin(), paramNames.cend(), getParams(), getParamDynamic(), getName());
+    addDynamicParamValues(dynamicParamValues, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd,
+                          getDerivedParams(), getDerivedParamDynamic(), getName());
+    return dynamicParamValues;
+}
+
+std::vector<std::pair<std::string, std::vector<std::string>>> NeuronGroup::getDynamicParamDependents() const
+{
+    DerivedParamNameIterCtx nmDerivedParams(getNeuronModel()->getDerivedParams());
+
+    std::vector<std::pair<std::string, std::vector<std::string>>> dynamicParamDependents;
+    addDynamicParamDependents(dynamicParamDependents, getNeuronModel()->getParamNames(), nmDerivedParams.nameBegin,
+                              getParamDynamic(), m_DerivedParamDependencies);
+    return dynamicParamDependents;
+}
+
 bool NeuronGroup::isInitCodeRequired() const
 {
     // Return true if any of the variables initialisers have any code
@@ -346,6 +418,30 @@ bool NeuronGroup::hasOutputToHost(int targetHostID) const
 
 }
 
+bool NeuronGroup::isSpikeTriggeredVarQueueRequired() const
+{
+    // Spike triggered variables only need queues if delay is required
+    if(!isDelayRequired()) {
+        return false;
+    }
+
+    // Are there any outgoing synapse groups with axonal delay and presynaptic WUM variables?
+    const bool preVars = std::any_of(getOutSyn().cbegin(), getOutSyn().cend(),
+                                     [](const SynapseGroup *sg)
+                                     {
+                                         return (sg->getDelaySteps() != 0) && !sg->getWUModel()->getPreVars().empty();
+                                     });
+
+    // Are there any incoming synapse groups with back-propagation delay and postsynaptic WUM variables?
+    const bool postVars = std::any_of(getInSyn().cbegin(), getInSyn().cend(),
+                                      [](const SynapseGroup *sg)
+                                      {
+                                          return (sg->getBackPropDelaySteps() != 0) && !sg->getWUModel()->getPostVars().empty();
+                                      });
+
+    return (isSpikeTimeRequired() || preVars || postVars);
+}
+
 std::string NeuronGroup::getCurrentQueueOffset(const std::string &devPrefix) const
 {
     assert(isDelayRequired());
@@ -360,6 +456,19 @@ std::string NeuronGroup::getPrevQueueOffset(const std::string &devPrefix) const
     return "(((" + devPrefix + "spkQuePtr" + getName() + " + " + std::to_string(getNumDelaySlots() - 1) + ") % " + std::to_string(getNumDelaySlots()) + ") * " + std::to_string(getNumNeurons()) + ")";
 }
 
+std::string NeuronGroup::getSpikeTimeValue(const std::string &value) const
+{
+    return isCompactSpikeTimesEnabled() ? ("(DT * " + value + ")") : value;
+}
+
+std::string NeuronGroup::getVersionedQueueOffset(const std::string &idx, unsigned int delaySteps) const
+{
+    assert(isVersionedDelayQueueRequired());
+
+    // **NOTE** the most recent values were written by the previous timestep's neuron update
+    return "versionedQueueOffset" + getName() + "(" + idx + ", (long long)iT - " + std::to_string(delaySteps + 1) + ")";
+}
+
 void NeuronGroup::injectCurrent(CurrentSource *src)
 {
     m_CurrentSources.push_back(src);
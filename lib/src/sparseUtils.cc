@@ -1,7 +1,9 @@
 #include "sparseUtils.h"
 
 // Standard C++ includes
+#include <atomic>
 #include <numeric>
+#include <thread>
 #include <vector>
 
 // Standard C includes
@@ -11,6 +13,23 @@
 #include "utils.h"
 
 
+//---------------------------------------------------------------------
+/*! \brief  Utility to free the arrays allocated by createDeltaIndices
+ */
+//---------------------------------------------------------------------
+void freeDeltaIndices(DeltaProjection *D)
+{
+    delete[] D->rowBase;
+    delete[] D->rowWidth;
+    delete[] D->rowStart;
+    delete[] D->words;
+    D->rowBase = NULL;
+    D->rowWidth = NULL;
+    D->rowStart = NULL;
+    D->words = NULL;
+    D->numWords = 0;
+}
+
 //---------------------------------------------------------------------
 /*! \brief  Utility to generate the SPARSE array structure with post-to-pre arrangement from the original pre-to-post arrangement where postsynaptic feedback is necessary (learning etc)
  */
@@ -72,6 +91,38 @@ void createPreIndices(unsigned int preN, unsigned int, SparseProjection * C)
 }
 
 
+//--------------------------------------------------------------------------
+/*! \brief Calls blockFunc with ranges of presynaptic neurons, distributing them between numThreads threads
+ */
+//--------------------------------------------------------------------------
+
+void parallelForRowBlocks(unsigned int preN, unsigned int numThreads, std::function<void(unsigned int begin, unsigned int end)> blockFunc)
+{
+    // Use small blocks so rows of differing density are balanced between threads
+    const unsigned int rowsPerBlock = 64;
+    const unsigned int numBlocks = (preN + rowsPerBlock - 1) / rowsPerBlock;
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::atomic<unsigned int> nextBlock(0);
+    auto worker = [preN, rowsPerBlock, numBlocks, &nextBlock, &blockFunc]()
+    {
+        for (unsigned int b = nextBlock++; b < numBlocks; b = nextBlock++) {
+            blockFunc(b * rowsPerBlock, std::min(preN, (b + 1) * rowsPerBlock));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 1; t < std::min(numThreads, numBlocks); t++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
 #ifndef CPU_ONLY
 //--------------------------------------------------------------------------
 /*! \brief Function for initializing conductance array indices for sparse matrices on the GPU
@@ -55,11 +55,15 @@ void StandardGeneratedSections::neuronLocalVarInit(
     
     // Also read spike time into local variable
     if(ng.isSpikeTimeRequired()) {
-        os << ttype << " lsT = " << devPrefix << "sT" << ng.getName() << "[";
-        if (ng.isDelayRequired()) {
-            os << "readDelayOffset + ";
+        std::string sT = devPrefix + "sT" + ng.getName() + "[";
+        if (ng.isVersionedDelayQueueRequired()) {
+            sT += "versionReadOffset + ";
         }
-        os << localID << "];" << std::endl;
+        else if (ng.isDelayRequired()) {
+            sT += "readDelayOffset + ";
+        }
+        sT += localID + "]";
+        os << ttype << " lsT = " << ng.getSpikeTimeValue(sT) << ";" << std::endl;
     }
 }
 //----------------------------------------------------------------------------
@@ -145,6 +149,7 @@ void StandardGeneratedSections::neuronCurrentInjection(
 
         string iCode = csm->getInjectionCode();
         substitute(iCode, "$(id)", localID);
+        substituteUpdateIntervalDT(iCode, ng.getUpdateInterval());
         StandardSubstitutions::currentSourceInjection(iCode, cs,
                             csVars, csDerivedParams, csExtraGlobalParams,
                             functions, ftype, rng);
@@ -164,49 +169,40 @@ void StandardGeneratedSections::neuronCopySpikeTriggeredVars(
     const std::string &localID)
 {
     // Spike triggered variables don't need to be copied if delay isn't required as there's only one copy of them
-    if(ng.isDelayRequired()) {
-        // Are there any outgoing synapse groups with axonal delay and presynaptic WUM variables?
-        const bool preVars = std::any_of(ng.getOutSyn().cbegin(), ng.getOutSyn().cend(),
-                                         [](const SynapseGroup *sg)
-                                         {
-                                             return (sg->getDelaySteps() != NO_DELAY) && !sg->getWUModel()->getPreVars().empty();
-                                         });
-
-        // Are there any incoming synapse groups with back-propagation delay and postsynaptic WUM variables?
-        const bool postVars = std::any_of(ng.getInSyn().cbegin(), ng.getInSyn().cend(),
-                                          [](const SynapseGroup *sg)
-                                          {
-                                              return (sg->getBackPropDelaySteps() != NO_DELAY) && !sg->getWUModel()->getPostVars().empty();
-                                          });
-
-        // If spike times, presynaptic variables or postsynaptic variables are required, add if clause
-        if(ng.isSpikeTimeRequired() || preVars || postVars) {
-            os << "else";
-            CodeStream::Scope b(os);
+    // **NOTE** versioned queues are only written when neurons spike so need no copying
+    if(ng.isSpikeTriggeredVarQueueRequired() && !ng.isVersionedDelayQueueRequired()) {
+        os << "else";
+        CodeStream::Scope b(os);
 
-            // If spike timing is required, copy spike time from register
-            if(ng.isSpikeTimeRequired()) {
-                os << devPrefix << "sT" << ng.getName() << "[writeDelayOffset + " << localID << "] = lsT;" << std::endl;
+        // If spike timing is required, copy spike time from register
+        // **NOTE** compact spike times are copied directly as lsT has been converted to a time
+        if(ng.isSpikeTimeRequired()) {
+            os << devPrefix << "sT" << ng.getName() << "[writeDelayOffset + " << localID << "] = ";
+            if(ng.isCompactSpikeTimesEnabled()) {
+                os << devPrefix << "sT" << ng.getName() << "[readDelayOffset + " << localID << "];" << std::endl;
+            }
+            else {
+                os << "lsT;" << std::endl;
             }
+        }
 
-            // Copy presynaptic WUM variables between delay slots
-            for(const auto *sg : ng.getOutSyn()) {
-                if(sg->getDelaySteps() != NO_DELAY) {
-                    for(const auto &v : sg->getWUModel()->getPreVars()) {
-                        os << devPrefix << v.first << sg->getName() << "[writeDelayOffset + " << localID <<  "] = ";
-                        os << devPrefix << v.first << sg->getName() << "[readDelayOffset + " << localID << "];" << std::endl;
-                    }
+        // Copy presynaptic WUM variables between delay slots
+        for(const auto *sg : ng.getOutSyn()) {
+            if(sg->getDelaySteps() != NO_DELAY) {
+                for(const auto &v : sg->getWUModel()->getPreVars()) {
+                    os << devPrefix << v.first << sg->getName() << "[writeDelayOffset + " << localID <<  "] = ";
+                    os << devPrefix << v.first << sg->getName() << "[readDelayOffset + " << localID << "];" << std::endl;
                 }
             }
+        }
 
 
-            // Copy postsynaptic WUM variables between delay slots
-            for(const auto *sg : ng.getInSyn()) {
-                if(sg->getBackPropDelaySteps() != NO_DELAY) {
-                    for(const auto &v : sg->getWUModel()->getPostVars()) {
-                        os << devPrefix << v.first << sg->getName() << "[writeDelayOffset + " << localID <<  "] = ";
-                        os << devPrefix << v.first << sg->getName() << "[readDelayOffset + " << localID << "];" << std::endl;
-                    }
+        // Copy postsynaptic WUM variables between delay slots
+        for(const auto *sg : ng.getInSyn()) {
+            if(sg->getBackPropDelaySteps() != NO_DELAY) {
+                for(const auto &v : sg->getWUModel()->getPostVars()) {
+                    os << devPrefix << v.first << sg->getName() << "[writeDelayOffset + " << localID <<  "] = ";
+                    os << devPrefix << v.first << sg->getName() << "[readDelayOffset + " << localID << "];" << std::endl;
                 }
             }
         }
@@ -233,7 +229,7 @@ void StandardGeneratedSections::weightUpdatePreSpike(
                 os << v.second << " l" << v.first << " = ";
                 os << devPrefix << v.first << sg->getName() << "[";
                 if (sg->getDelaySteps() != NO_DELAY) {
-                    os << "readDelayOffset + ";
+                    os << (ng.isVersionedDelayQueueRequired() ? "versionReadOffset + " : "readDelayOffset + ");
                 }
                 os << localID << "];" << std::endl;
             }
@@ -247,7 +243,7 @@ void StandardGeneratedSections::weightUpdatePreSpike(
             for(const auto &v : sg->getWUModel()->getPreVars()) {
                 os << devPrefix << v.first << sg->getName() << "[";
                 if (sg->getDelaySteps() != NO_DELAY) {
-                    os << "writeDelayOffset + ";
+                    os << (ng.isVersionedDelayQueueRequired() ? "versionWriteOffset + " : "writeDelayOffset + ");
                 }
                 os << localID <<  "] = l" << v.first << ";" << std::endl;
             }
@@ -275,7 +271,7 @@ void StandardGeneratedSections::weightUpdatePostSpike(
                 os << v.second << " l" << v.first << " = ";
                 os << devPrefix << v.first << sg->getName() << "[";
                 if (sg->getBackPropDelaySteps() != NO_DELAY) {
-                    os << "readDelayOffset + ";
+                    os << (ng.isVersionedDelayQueueRequired() ? "versionReadOffset + " : "readDelayOffset + ");
                 }
                 os << localID << "];" << std::endl;
             }
@@ -289,7 +285,7 @@ void StandardGeneratedSections::weightUpdatePostSpike(
             for(const auto &v : sg->getWUModel()->getPostVars()) {
                 os << devPrefix << v.first << sg->getName() << "[";
                 if (sg->getBackPropDelaySteps() != NO_DELAY) {
-                    os << "writeDelayOffset + ";
+                    os << (ng.isVersionedDelayQueueRequired() ? "versionWriteOffset + " : "writeDelayOffset + ");
                 }
                 os << localID <<  "] = l" << v.first << ";" << std::endl;
             }
@@ -30,6 +30,46 @@ void initVariable(
     code = ensureFtype(code, ftype);
     checkUnreplacedVariables(code, "initVar");
 }
+
+// Get index of presynaptic weight update model variable, accounting for axonal delay
+std::string getDelayedPreVarIdx(const SynapseGroup &sg, const std::string &preIdx)
+{
+    if(sg.getDelaySteps() == NO_DELAY) {
+        return preIdx;
+    }
+    else if(sg.getSrcNeuronGroup()->isVersionedDelayQueueRequired()) {
+        return sg.getSrcNeuronGroup()->getVersionedQueueOffset(preIdx, sg.getDelaySteps()) + " + " + preIdx;
+    }
+    else {
+        return "preReadDelayOffset + " + preIdx;
+    }
+}
+
+// Get index of postsynaptic weight update model variable, accounting for back-propagation delay
+std::string getDelayedPostVarIdx(const SynapseGroup &sg, const std::string &postIdx)
+{
+    if(sg.getBackPropDelaySteps() == NO_DELAY) {
+        return postIdx;
+    }
+    else if(sg.getTrgNeuronGroup()->isVersionedDelayQueueRequired()) {
+        return sg.getTrgNeuronGroup()->getVersionedQueueOffset(postIdx, sg.getBackPropDelaySteps()) + " + " + postIdx;
+    }
+    else {
+        return "postReadDelayOffset + " + postIdx;
+    }
+}
+
+void functionTableSubstitutions(std::string &code, const NeuronGroup &ng)
+{
+    for(const auto &f : ng.getFunctionTables()) {
+        regexFuncSubstitute(code, f.getFunctionName(), f.getTableFunctionName(ng.getName()));
+
+        // By now, standard maths functions may have been replaced with their single precision versions
+        if(f.isMathsFunction()) {
+            regexFuncSubstitute(code, f.getFunctionName() + "f", f.getTableFunctionName(ng.getName()));
+        }
+    }
+}
 }
 
 //----------------------------------------------------------------------------
@@ -55,8 +95,8 @@ void StandardSubstitutions::postSynapseApplyInput(
     substitute(psCode, "$(Isyn)", "Isyn");
 
     name_substitutions(psCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
-    value_substitutions(psCode, ng.getNeuronModel()->getParamNames(), ng.getParams());
-    value_substitutions(psCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams());
+    param_substitutions(psCode, ng.getNeuronModel()->getParamNames(), ng.getParams(), ng.getParamDynamic(), ng.getName());
+    param_substitutions(psCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams(), ng.getDerivedParamDynamic(), ng.getName());
 
     if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
         name_substitutions(psCode, "lps", psmVars.nameBegin, psmVars.nameEnd, sg->getName());
@@ -64,11 +104,12 @@ void StandardSubstitutions::postSynapseApplyInput(
     else {
         value_substitutions(psCode, psmVars.nameBegin, psmVars.nameEnd, sg->getPSConstInitVals());
     }
-    value_substitutions(psCode, sg->getPSModel()->getParamNames(), sg->getPSParams());
+    param_substitutions(psCode, sg->getPSModel()->getParamNames(), sg->getPSParams(), sg->getPSParamDynamic(), sg->getName());
 
     // Create iterators to iterate over the names of the postsynaptic model's derived parameters
-    value_substitutions(psCode, psmDerivedParams.nameBegin, psmDerivedParams.nameEnd, sg->getPSDerivedParams());
+    param_substitutions(psCode, psmDerivedParams.nameBegin, psmDerivedParams.nameEnd, sg->getPSDerivedParams(), sg->getPSDerivedParamDynamic(), sg->getName());
     name_substitutions(psCode, "", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substituteUpdateIntervalDT(psCode, ng.getUpdateInterval());
 
     functionSubstitutions(psCode, ftype, functions);
     substitute(psCode, "$(rng)", rng);
@@ -94,11 +135,12 @@ void StandardSubstitutions::postSynapseDecay(
     substitute(pdCode, "$(t)", "t");
 
     name_substitutions(pdCode, "lps", psmVars.nameBegin, psmVars.nameEnd, sg->getName());
-    value_substitutions(pdCode, sg->getPSModel()->getParamNames(), sg->getPSParams());
-    value_substitutions(pdCode, psmDerivedParams.nameBegin, psmDerivedParams.nameEnd, sg->getPSDerivedParams());
+    param_substitutions(pdCode, sg->getPSModel()->getParamNames(), sg->getPSParams(), sg->getPSParamDynamic(), sg->getName());
+    param_substitutions(pdCode, psmDerivedParams.nameBegin, psmDerivedParams.nameEnd, sg->getPSDerivedParams(), sg->getPSDerivedParamDynamic(), sg->getName());
     name_substitutions(pdCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
-    value_substitutions(pdCode, ng.getNeuronModel()->getParamNames(), ng.getParams());
-    value_substitutions(pdCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams());
+    param_substitutions(pdCode, ng.getNeuronModel()->getParamNames(), ng.getParams(), ng.getParamDynamic(), ng.getName());
+    param_substitutions(pdCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams(), ng.getDerivedParamDynamic(), ng.getName());
+    substituteUpdateIntervalDT(pdCode, ng.getUpdateInterval());
 
     functionSubstitutions(pdCode, ftype, functions);
     substitute(pdCode, "$(rng)", rng);
@@ -121,16 +163,38 @@ void StandardSubstitutions::neuronThresholdCondition(
     name_substitutions(thCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
     substitute(thCode, "$(Isyn)", "Isyn");
     substitute(thCode, "$(sT)", "lsT");
-    value_substitutions(thCode, ng.getNeuronModel()->getParamNames(), ng.getParams());
-    value_substitutions(thCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams());
+    param_substitutions(thCode, ng.getNeuronModel()->getParamNames(), ng.getParams(), ng.getParamDynamic(), ng.getName());
+    param_substitutions(thCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams(), ng.getDerivedParamDynamic(), ng.getName());
     name_substitutions(thCode, "", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substituteUpdateIntervalDT(thCode, ng.getUpdateInterval());
 
     functionSubstitutions(thCode, ftype, functions);
     substitute(thCode, "$(rng)", rng);
     thCode= ensureFtype(thCode, ftype);
+    functionTableSubstitutions(thCode, ng);
     checkUnreplacedVariables(thCode, ng.getName() + " : thresholdConditionCode");
 }
 
+void StandardSubstitutions::neuronRestCondition(
+    std::string &rCode,
+    const NeuronGroup &ng,
+    const VarNameIterCtx &nmVars,
+    const DerivedParamNameIterCtx &nmDerivedParams,
+    const ExtraGlobalParamNameIterCtx &nmExtraGlobalParams,
+    const std::vector<FunctionTemplate> &functions,
+    const std::string &ftype)
+{
+    substitute(rCode, "$(t)", "t");
+    name_substitutions(rCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
+    param_substitutions(rCode, ng.getNeuronModel()->getParamNames(), ng.getParams(), ng.getParamDynamic(), ng.getName());
+    param_substitutions(rCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams(), ng.getDerivedParamDynamic(), ng.getName());
+    name_substitutions(rCode, "", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+
+    functionSubstitutions(rCode, ftype, functions);
+    rCode= ensureFtype(rCode, ftype);
+    checkUnreplacedVariables(rCode, ng.getName() + " : restConditionCode");
+}
+
 void StandardSubstitutions::neuronSim(
     std::string &sCode,
     const NeuronGroup &ng,
@@ -143,15 +207,17 @@ void StandardSubstitutions::neuronSim(
 {
     substitute(sCode, "$(t)", "t");
     name_substitutions(sCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
-    value_substitutions(sCode, ng.getNeuronModel()->getParamNames(), ng.getParams());
-    value_substitutions(sCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams());
+    param_substitutions(sCode, ng.getNeuronModel()->getParamNames(), ng.getParams(), ng.getParamDynamic(), ng.getName());
+    param_substitutions(sCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams(), ng.getDerivedParamDynamic(), ng.getName());
     name_substitutions(sCode, "", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
     substitute(sCode, "$(Isyn)", "Isyn");
     substitute(sCode, "$(sT)", "lsT");
+    substituteUpdateIntervalDT(sCode, ng.getUpdateInterval());
 
     functionSubstitutions(sCode, ftype, functions);
     substitute(sCode, "$(rng)", rng);
     sCode = ensureFtype(sCode, ftype);
+    functionTableSubstitutions(sCode, ng);
     checkUnreplacedVariables(sCode, ng.getName() + " : neuron simCode");
 }
 
@@ -187,15 +253,17 @@ void StandardSubstitutions::neuronReset(
 {
     substitute(rCode, "$(t)", "t");
     name_substitutions(rCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
-    value_substitutions(rCode, ng.getNeuronModel()->getParamNames(), ng.getParams());
-    value_substitutions(rCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams());
+    param_substitutions(rCode, ng.getNeuronModel()->getParamNames(), ng.getParams(), ng.getParamDynamic(), ng.getName());
+    param_substitutions(rCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams(), ng.getDerivedParamDynamic(), ng.getName());
     substitute(rCode, "$(Isyn)", "Isyn");
     substitute(rCode, "$(sT)", "lsT");
     name_substitutions(rCode, "", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substituteUpdateIntervalDT(rCode, ng.getUpdateInterval());
 
     functionSubstitutions(rCode, ftype, functions);
     substitute(rCode, "$(rng)", rng);
     rCode = ensureFtype(rCode, ftype);
+    functionTableSubstitutions(rCode, ng);
     checkUnreplacedVariables(rCode, ng.getName() + " : resetCode");
 }
 
@@ -211,8 +279,8 @@ void StandardSubstitutions::weightUpdateThresholdCondition(
     const std::string &ftype,
     double dt)
 {
-    value_substitutions(eCode, sg.getWUModel()->getParamNames(), sg.getWUParams());
-    value_substitutions(eCode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg.getWUDerivedParams());
+    param_substitutions(eCode, sg.getWUModel()->getParamNames(), sg.getWUParams(), sg.getWUParamDynamic(), sg.getName());
+    param_substitutions(eCode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg.getWUDerivedParams(), sg.getWUDerivedParamDynamic(), sg.getName());
     name_substitutions(eCode, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg.getName());
     neuron_substitutions_in_synaptic_code(eCode, &sg, preIdx, postIdx, devPrefix, dt);
     substitute(eCode, "$(id_pre)", preIdx);
@@ -242,15 +310,15 @@ void StandardSubstitutions::weightUpdateSim(
          value_substitutions(wCode, wuVars.nameBegin, wuVars.nameEnd, sg.getWUConstInitVals());
      }
 
-    value_substitutions(wCode, sg.getWUModel()->getParamNames(), sg.getWUParams());
-    value_substitutions(wCode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg.getWUDerivedParams());
+    param_substitutions(wCode, sg.getWUModel()->getParamNames(), sg.getWUParams(), sg.getWUParamDynamic(), sg.getName());
+    param_substitutions(wCode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg.getWUDerivedParams(), sg.getWUDerivedParamDynamic(), sg.getName());
     name_substitutions(wCode, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg.getName());
 
     // Substitute names of pre and postsynaptic weight update variables
-    const std::string delayedPreIdx = (sg.getDelaySteps() == NO_DELAY) ? preIdx : "preReadDelayOffset + " + preIdx;
+    const std::string delayedPreIdx = getDelayedPreVarIdx(sg, preIdx);
     name_substitutions(wCode, devPrefix, wuPreVars.nameBegin, wuPreVars.nameEnd, sg.getName() + "[" + delayedPreIdx + "]");
 
-    const std::string delayedPostIdx = (sg.getBackPropDelaySteps() == NO_DELAY) ? postIdx : "postReadDelayOffset + " + postIdx;
+    const std::string delayedPostIdx = getDelayedPostVarIdx(sg, postIdx);
     name_substitutions(wCode, devPrefix, wuPostVars.nameBegin, wuPostVars.nameEnd, sg.getName() + "[" + delayedPostIdx + "]");
 
     substitute(wCode, "$(addtoinSyn)", "addtoinSyn");
@@ -283,22 +351,23 @@ void StandardSubstitutions::weightUpdateDynamics(
      }
 
     // substitute parameter values for parameters in synapseDynamics code
-    value_substitutions(SDcode, sg->getWUModel()->getParamNames(), sg->getWUParams());
+    param_substitutions(SDcode, sg->getWUModel()->getParamNames(), sg->getWUParams(), sg->getWUParamDynamic(), sg->getName());
 
     // Substitute names of pre and postsynaptic weight update variables
-    const std::string delayedPreIdx = (sg->getDelaySteps() == NO_DELAY) ? preIdx : "preReadDelayOffset + " + preIdx;
+    const std::string delayedPreIdx = getDelayedPreVarIdx(*sg, preIdx);
     name_substitutions(SDcode, devPrefix, wuPreVars.nameBegin, wuPreVars.nameEnd, sg->getName() + "[" + delayedPreIdx + "]");
 
-    const std::string delayedPostIdx = (sg->getBackPropDelaySteps() == NO_DELAY) ? postIdx : "postReadDelayOffset + " + postIdx;
+    const std::string delayedPostIdx = getDelayedPostVarIdx(*sg, postIdx);
     name_substitutions(SDcode, devPrefix, wuPostVars.nameBegin, wuPostVars.nameEnd, sg->getName() + "[" + delayedPostIdx + "]");
 
     // substitute values for derived parameters in synapseDynamics code
-    value_substitutions(SDcode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams());
+    param_substitutions(SDcode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams(), sg->getWUDerivedParamDynamic(), sg->getName());
     name_substitutions(SDcode, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg->getName());
     substitute(SDcode, "$(addtoinSyn)", "addtoinSyn");
     neuron_substitutions_in_synaptic_code(SDcode, sg, preIdx, postIdx, devPrefix, dt);
     substitute(SDcode, "$(id_pre)", preIdx);
     substitute(SDcode, "$(id_post)", postIdx);
+    substituteUpdateIntervalDT(SDcode, sg->getSynapseDynamicsUpdateInterval());
 
     functionSubstitutions(SDcode, ftype, functions);
     SDcode= ensureFtype(SDcode, ftype);
@@ -323,17 +392,17 @@ void StandardSubstitutions::weightUpdatePostLearn(
     const string &postVarPrefix,   //!< prefix to be used for postsynaptic variable accesses - typically combined with suffix to wrap in function call such as __ldg(&XXX)
     const string &postVarSuffix)  //!< suffix to be used for postsynaptic variable accesses - typically combined with prefix to wrap in function call such as __ldg(&XXX)
 {
-    value_substitutions(code, sg->getWUModel()->getParamNames(), sg->getWUParams());
-    value_substitutions(code, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams());
+    param_substitutions(code, sg->getWUModel()->getParamNames(), sg->getWUParams(), sg->getWUParamDynamic(), sg->getName());
+    param_substitutions(code, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams(), sg->getWUDerivedParamDynamic(), sg->getName());
     name_substitutions(code, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg->getName());
-    substitute(code, "$(id_pre)", code);
-    substitute(code, "$(id_post)", code);
+    substitute(code, "$(id_pre)", preIdx);
+    substitute(code, "$(id_post)", postIdx);
 
     // Substitute names of pre and postsynaptic weight update variables
-    const std::string delayedPreIdx = (sg->getDelaySteps() == NO_DELAY) ? preIdx : "preReadDelayOffset + " + preIdx;
+    const std::string delayedPreIdx = getDelayedPreVarIdx(*sg, preIdx);
     name_substitutions(code, preVarPrefix + devPrefix, wuPreVars.nameBegin, wuPreVars.nameEnd, sg->getName() + "[" + delayedPreIdx + "]" + preVarSuffix, "");
 
-    const std::string delayedPostIdx = (sg->getBackPropDelaySteps() == NO_DELAY) ? postIdx : "postReadDelayOffset + " + postIdx;
+    const std::string delayedPostIdx = getDelayedPostVarIdx(*sg, postIdx);
     name_substitutions(code, postVarPrefix + devPrefix, wuPostVars.nameBegin, wuPostVars.nameEnd, sg->getName() + "[" + delayedPostIdx + "]" + postVarSuffix, "");
 
     // presynaptic neuron variables and parameters
@@ -363,13 +432,14 @@ void StandardSubstitutions::weightUpdatePreSpike(
     // Perform standard substitutions
     substitute(code, "$(t)", "t");
 
-    value_substitutions(code, sg->getWUModel()->getParamNames(), sg->getWUParams());
-    value_substitutions(code, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams());
+    param_substitutions(code, sg->getWUModel()->getParamNames(), sg->getWUParams(), sg->getWUParamDynamic(), sg->getName());
+    param_substitutions(code, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams(), sg->getWUDerivedParamDynamic(), sg->getName());
     name_substitutions(code, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg->getName());
     name_substitutions(code, "l", wuPreVars.nameBegin, wuPreVars.nameEnd, "");
 
     const std::string offset = sg->getSrcNeuronGroup()->isDelayRequired() ? "readDelayOffset + " : "";
-    preNeuronSubstitutionsInSynapticCode(code, sg, offset, "", preIdx, devPrefix);
+    const std::string spikeTimeOffset = sg->getSrcNeuronGroup()->isVersionedDelayQueueRequired() ? "versionReadOffset + " : offset;
+    preNeuronSubstitutionsInSynapticCode(code, sg, offset, spikeTimeOffset, "", preIdx, devPrefix);
 
     functionSubstitutions(code, ftype, functions);
     code = ensureFtype(code, ftype);
@@ -393,14 +463,15 @@ void StandardSubstitutions::weightUpdatePostSpike(
     // Perform standard substitutions
     substitute(code, "$(t)", "t");
 
-    value_substitutions(code, sg->getWUModel()->getParamNames(), sg->getWUParams());
-    value_substitutions(code, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams());
+    param_substitutions(code, sg->getWUModel()->getParamNames(), sg->getWUParams(), sg->getWUParamDynamic(), sg->getName());
+    param_substitutions(code, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams(), sg->getWUDerivedParamDynamic(), sg->getName());
     name_substitutions(code, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg->getName());
 
     name_substitutions(code, "l", wuPostVars.nameBegin, wuPostVars.nameEnd, "");
 
     const std::string offset = sg->getTrgNeuronGroup()->isDelayRequired() ? "readDelayOffset + " : "";
-    postNeuronSubstitutionsInSynapticCode(code, sg, offset, "", postIdx, devPrefix);
+    const std::string spikeTimeOffset = sg->getTrgNeuronGroup()->isVersionedDelayQueueRequired() ? "versionReadOffset + " : offset;
+    postNeuronSubstitutionsInSynapticCode(code, sg, offset, spikeTimeOffset, "", postIdx, devPrefix);
 
     functionSubstitutions(code, ftype, functions);
     code = ensureFtype(code, ftype);
@@ -462,8 +533,9 @@ std::string StandardSubstitutions::initSparseConnectivity(
     // Get user code string
     std::string code = connectInit.getSnippet()->getRowBuildCode();
 
-    // Substitute presynaptic index and number of postsynaptic neurons
+    // Substitute presynaptic index and number of pre and postsynaptic neurons
     substitute(code, "$(id_pre)", preIdx);
+    substitute(code, "$(num_pre)", std::to_string(sg.getSrcNeuronGroup()->getNumNeurons()));
     substitute(code, "$(num_post)", std::to_string(numTrgNeurons));
 
     // Replace endRow() with break to stop loop
@@ -3,6 +3,8 @@
 // Standard includes
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 
 // GeNN includes
 #include "codeGenUtils.h"
@@ -47,13 +49,16 @@ SynapseGroup::SynapseGroup(const std::string name, SynapseMatrixType matrixType,
                            NeuronGroup *srcNeuronGroup, NeuronGroup *trgNeuronGroup,
                            const InitSparseConnectivitySnippet::Init &connectivityInitialiser)
     :   m_PaddedKernelIDRange(0, 0), m_Name(name), m_SpanType(SpanType::POSTSYNAPTIC), m_DelaySteps(delaySteps), m_BackPropDelaySteps(0),
-    	m_MaxDendriticDelayTimesteps(1), m_MatrixType(matrixType),
+    	m_MaxDendriticDelayTimesteps(1), m_SynapseDynamicsActivityWindow(0), m_SynapseDynamicsUpdateInterval(1), m_OutOfCore(false), m_CacheBlockSize(0), m_DeltaEncodingEnabled(false), m_DeltaEncodingIndFreed(false), m_SparseDendriticDelayEnabled(false), m_SpikePropagationThreads(1), m_MatrixType(matrixType),
         m_SrcNeuronGroup(srcNeuronGroup), m_TrgNeuronGroup(trgNeuronGroup),
         m_TrueSpikeRequired(false), m_SpikeEventRequired(false), m_EventThresholdReTestRequired(false),
         m_InSynVarMode(GENN_PREFERENCES::defaultVarMode),  m_DendriticDelayVarMode(GENN_PREFERENCES::defaultVarMode),
-        m_WUModel(wu), m_WUParams(wuParams), m_WUVarInitialisers(wuVarInitialisers), m_WUPreVarInitialisers(wuPreVarInitialisers), m_WUPostVarInitialisers(wuPostVarInitialisers),
-        m_PSModel(ps), m_PSParams(psParams), m_PSVarInitialisers(psVarInitialisers),
-        m_WUVarMode(wuVarInitialisers.size(), GENN_PREFERENCES::defaultVarMode), m_WUPreVarMode(wuPreVarInitialisers.size(), GENN_PREFERENCES::defaultVarMode),
+        m_WUModel(wu), m_WUParams(wuParams), m_WUParamDynamic(wuParams.size(), false),
+        m_WUVarInitialisers(wuVarInitialisers), m_WUPreVarInitialisers(wuPreVarInitialisers), m_WUPostVarInitialisers(wuPostVarInitialisers),
+        m_PSModel(ps), m_PSParams(psParams), m_PSParamDynamic(psParams.size(), false), m_PSVarInitialisers(psVarInitialisers),
+        m_WUVarMode(wuVarInitialisers.size(), GENN_PREFERENCES::defaultVarMode), m_WUVarStorageType(wuVarInitialisers.size(), VarStorageType::DEFAULT),
+        m_WUVarCodebooks(wuVarInitialisers.size()),
+        m_WUPreVarMode(wuPreVarInitialisers.size(), GENN_PREFERENCES::defaultVarMode),
         m_WUPostVarMode(wuPostVarInitialisers.size(), GENN_PREFERENCES::defaultVarMode), m_PSVarMode(psVarInitialisers.size(), GENN_PREFERENCES::defaultVarMode),
         m_ConnectivityInitialiser(connectivityInitialiser), m_SparseConnectivityVarMode(GENN_PREFERENCES::defaultSparseConnectivityMode),
         m_PSModelTargetName(name)
@@ -107,6 +112,57 @@ void SynapseGroup::setWUVarMode(const std::string &varName, VarMode mode)
     m_WUVarMode[getWUModel()->getVarIndex(varName)] = mode;
 }
 
+void SynapseGroup::setWUVarStorageType(const std::string &varName, VarStorageType type)
+{
+#ifndef CPU_ONLY
+    if(type != VarStorageType::DEFAULT) {
+        gennError("setWUVarStorageType: Reduced precision storage is only supported in CPU_ONLY mode.");
+    }
+#endif
+    if(!(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
+        gennError("setWUVarStorageType: Synapse group '" + getName() + "' does not have individual weight update model variables.");
+    }
+
+    const size_t varIndex = getWUModel()->getVarIndex(varName);
+    const std::string varType = getWUModel()->getVars()[varIndex].second;
+    if(varType != "scalar" && varType != "float" && varType != "double") {
+        gennError("setWUVarStorageType: Weight update model variable '" + varName + "' of synapse group '" + getName() + "' is not floating point.");
+    }
+
+    if(type == VarStorageType::CODEBOOK8) {
+        gennError("setWUVarStorageType: Use setWUVarCodebook to store weight update model variable '" + varName + "' of synapse group '" + getName() + "' in a codebook.");
+    }
+
+    m_WUVarStorageType[varIndex] = type;
+}
+
+void SynapseGroup::setWUVarCodebook(const std::string &varName, const std::vector<double> &values)
+{
+    // Sort and remove duplicate values so nearest entries can be found with a binary search
+    std::vector<double> codebook(values);
+    std::sort(codebook.begin(), codebook.end());
+    codebook.erase(std::unique(codebook.begin(), codebook.end()), codebook.end());
+    if(codebook.empty() || codebook.size() > 256) {
+        gennError("setWUVarCodebook: Codebook for weight update model variable '" + varName + "' of synapse group '" + getName() + "' must contain between 1 and 256 distinct values.");
+    }
+
+#ifndef CPU_ONLY
+    gennError("setWUVarCodebook: Codebook storage is only supported in CPU_ONLY mode.");
+#endif
+    if(!(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
+        gennError("setWUVarCodebook: Synapse group '" + getName() + "' does not have individual weight update model variables.");
+    }
+
+    const size_t varIndex = getWUModel()->getVarIndex(varName);
+    const std::string varType = getWUModel()->getVars()[varIndex].second;
+    if(varType != "scalar" && varType != "float" && varType != "double") {
+        gennError("setWUVarCodebook: Weight update model variable '" + varName + "' of synapse group '" + getName() + "' is not floating point.");
+    }
+
+    m_WUVarStorageType[varIndex] = VarStorageType::CODEBOOK8;
+    m_WUVarCodebooks[varIndex] = codebook;
+}
+
 void SynapseGroup::setWUPreVarMode(const std::string &varName, VarMode mode)
 {
     m_WUPreVarMode[getWUModel()->getPreVarIndex(varName)] = mode;
@@ -156,6 +212,15 @@ void SynapseGroup::setMaxDendriticDelayTimesteps(unsigned int maxDendriticDelayT
     m_MaxDendriticDelayTimesteps = maxDendriticDelayTimesteps;
 }
 
+void SynapseGroup::setSparseDendriticDelayEnabled(bool enabled)
+{
+    if(enabled && !isDendriticDelayRequired()) {
+        gennError("setSparseDendriticDelayEnabled: Synapse group '" + getName() + "' does not use dendritic delays.");
+    }
+
+    m_SparseDendriticDelayEnabled = enabled;
+}
+
 void SynapseGroup::setSpanType(SpanType spanType)
 {
     if (getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
@@ -173,6 +238,114 @@ void SynapseGroup::setBackPropDelaySteps(unsigned int timesteps)
     m_TrgNeuronGroup->checkNumDelaySlots(m_BackPropDelaySteps);
 }
 
+void SynapseGroup::setSynapseDynamicsActivityWindow(unsigned int timesteps)
+{
+    if (getWUModel()->getSynapseDynamicsCode().empty()) {
+        gennError("setSynapseDynamicsActivityWindow: Synapse group '" + getName() + "' has no synapse dynamics.");
+    }
+
+    m_SynapseDynamicsActivityWindow = timesteps;
+}
+
+void SynapseGroup::setSynapseDynamicsUpdateInterval(unsigned int timesteps)
+{
+    if (getWUModel()->getSynapseDynamicsCode().empty()) {
+        gennError("setSynapseDynamicsUpdateInterval: Synapse group '" + getName() + "' has no synapse dynamics.");
+    }
+    if (timesteps == 0) {
+        gennError("setSynapseDynamicsUpdateInterval: Synapse group '" + getName() + "' update interval must be at least one timestep.");
+    }
+
+    m_SynapseDynamicsUpdateInterval = timesteps;
+}
+
+void SynapseGroup::setSynapseDynamicsSkipMaskVar(const std::string &varName)
+{
+    if (getWUModel()->getSynapseDynamicsCode().empty()) {
+        gennError("setSynapseDynamicsSkipMaskVar: Synapse group '" + getName() + "' has no synapse dynamics.");
+    }
+    if (!(getMatrixType() & SynapseMatrixConnectivity::DENSE) || !(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
+        gennError("setSynapseDynamicsSkipMaskVar: Synapse group '" + getName() + "' must use DENSE_INDIVIDUALG connectivity to skip synapses.");
+    }
+
+    // Check variable exists
+    getWUModel()->getVarIndex(varName);
+
+    m_SynapseDynamicsSkipMaskVar = varName;
+}
+
+void SynapseGroup::setOutOfCore(bool outOfCore)
+{
+    if(outOfCore) {
+        if(!(getMatrixType() & SynapseMatrixConnectivity::YALE) && !(getMatrixType() & SynapseMatrixConnectivity::RAGGED)) {
+            gennError("setOutOfCore: Synapse group '" + getName() + "' must use YALE or RAGGED connectivity to be stored out-of-core.");
+        }
+        if(!getWUModel()->getLearnPostCode().empty() || !getWUModel()->getSynapseDynamicsCode().empty()) {
+            gennError("setOutOfCore: Synapse group '" + getName() + "' must not have postsynaptic learning or synapse dynamics to be stored out-of-core.");
+        }
+    }
+
+    m_OutOfCore = outOfCore;
+}
+
+void SynapseGroup::setConnectivityFileWeightVar(const std::string &varName)
+{
+    if (!(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
+        gennError("setConnectivityFileWeightVar: Synapse group '" + getName() + "' must have individual weights to load them from a connectivity file.");
+    }
+
+    // Check variable exists and can hold weights
+    const auto vars = getWUModel()->getVars();
+    const auto var = std::find_if(vars.cbegin(), vars.cend(),
+                                  [&varName](const std::pair<std::string, std::string> &v){ return (v.first == varName); });
+    if (var == vars.cend()) {
+        gennError("setConnectivityFileWeightVar: Synapse group '" + getName() + "' has no weight update model variable '" + varName + "'.");
+    }
+    if (var->second != "scalar" && var->second != "float" && var->second != "double") {
+        gennError("setConnectivityFileWeightVar: Weight update model variable '" + varName + "' of synapse group '" + getName() + "' has type '" + var->second + "' which cannot hold weights.");
+    }
+
+    m_ConnectivityFileWeightVar = varName;
+}
+
+void SynapseGroup::setDeltaEncodingEnabled(bool enabled, bool freeInd)
+{
+    if(enabled && !(getMatrixType() & SynapseMatrixConnectivity::RAGGED)) {
+        gennError("setDeltaEncodingEnabled: Synapse group '" + getName() + "' must use RAGGED connectivity to delta-encode it.");
+    }
+    if(enabled && freeInd && (!getWUModel()->getLearnPostCode().empty() || !getWUModel()->getSynapseDynamicsCode().empty())) {
+        gennError("setDeltaEncodingEnabled: Synapse group '" + getName() + "' must not have postsynaptic learning or synapse dynamics to free ind.");
+    }
+
+    m_DeltaEncodingEnabled = enabled;
+    m_DeltaEncodingIndFreed = enabled && freeInd;
+}
+
+void SynapseGroup::setSpikePropagationThreads(unsigned int numThreads)
+{
+    if(numThreads == 0) {
+        gennError("setSpikePropagationThreads: Synapse group '" + getName() + "' must propagate spikes on at least one thread.");
+    }
+
+    m_SpikePropagationThreads = numThreads;
+}
+
+bool SynapseGroup::isCacheBlocked() const
+{
+    // Blocking only makes a difference if there is more than one block of postsynaptic neurons
+    return (m_CacheBlockSize > 0) && (getTrgNeuronGroup()->getNumNeurons() > m_CacheBlockSize);
+}
+
+void SynapseGroup::setWUParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_WUParamDynamic[getWUModel()->getParamIndex(paramName)] = dynamic;
+}
+
+void SynapseGroup::setPSParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_PSParamDynamic[getPSModel()->getParamIndex(paramName)] = dynamic;
+}
+
 void SynapseGroup::initDerivedParams(double dt)
 {
     auto wuDerivedParams = getWUModel()->getDerivedParams();
@@ -188,10 +361,18 @@ void SynapseGroup::initDerivedParams(double dt)
     }
 
     // Loop through PSM derived parameters
+    // **NOTE** postsynaptic models are evaluated as part of the target neuron group's update so use its timestep
+    const double psDT = dt * getTrgNeuronGroup()->getUpdateInterval();
     for(const auto &d : psDerivedParams) {
-        m_PSDerivedParams.push_back(d.second(m_PSParams, dt));
+        m_PSDerivedParams.push_back(d.second(m_PSParams, psDT));
     }
 
+    // Derived parameters calculated from any parameters which can change at runtime must also be stored in variables
+    m_WUDerivedParamDependencies = WeightUpdateModels::Base::getDerivedParamDependencies(wuDerivedParams, m_WUParams, m_WUParamDynamic, dt);
+    m_PSDerivedParamDependencies = PostsynapticModels::Base::getDerivedParamDependencies(psDerivedParams, m_PSParams, m_PSParamDynamic, psDT);
+    m_WUDerivedParamDynamic = WeightUpdateModels::Base::getDynamicDerivedParams(m_WUDerivedParamDependencies, wuDerivedParams.size());
+    m_PSDerivedParamDynamic = PostsynapticModels::Base::getDynamicDerivedParams(m_PSDerivedParamDependencies, psDerivedParams.size());
+
     // Initialise derived parameters for WU variable initialisers
     for(auto &v : m_WUVarInitialisers) {
         v.initDerivedParams(dt);
@@ -285,6 +466,97 @@ VarMode SynapseGroup::getWUVarMode(const std::string &var) const
     return m_WUVarMode[getWUModel()->getVarIndex(var)];
 }
 
+bool SynapseGroup::isPSParamDynamicRequired() const
+{
+    return (std::find(m_PSParamDynamic.cbegin(), m_PSParamDynamic.cend(), true) != m_PSParamDynamic.cend());
+}
+
+std::vector<std::pair<std::string, double>> SynapseGroup::getDynamicParamValues() const
+{
+    DerivedParamNameIterCtx wuDerivedParams(getWUModel()->getDerivedParams());
+    DerivedParamNameIterCtx psDerivedParams(getPSModel()->getDerivedParams());
+    const auto wuParamNames = getWUModel()->getParamNames();
+    const auto psParamNames = getPSModel()->getParamNames();
+
+    std::vector<std::pair<std::string, double>> dynamicParamValues;
+    addDynamicParamValues(dynamicParamValues, wuParamNames.cbegin(), wuParamNames.cend(), getWUParams(), getWUParamDynamic(), getName());
+    addDynamicParamValues(dynamicParamValues, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd,
+                          getWUDerivedParams(), getWUDerivedParamDynamic(), getName());
+    addDynamicParamValues(dynamicParamValues, psParamNames.cbegin(), psParamNames.cend(), getPSParams(), getPSParamDynamic(), getName());
+    addDynamicParamValues(dynamicParamValues, psDerivedParams.nameBegin, psDerivedParams.nameEnd,
+                          getPSDerivedParams(), getPSDerivedParamDynamic(), getName());
+    return dynamicParamValues;
+}
+
+std::vector<std::pair<std::string, std::vector<std::string>>> SynapseGroup::getDynamicParamDependents() const
+{
+    DerivedParamNameIterCtx wuDerivedParams(getWUModel()->getDerivedParams());
+    DerivedParamNameIterCtx psDerivedParams(getPSModel()->getDerivedParams());
+
+    std::vector<std::pair<std::string, std::vector<std::string>>> dynamicParamDependents;
+    addDynamicParamDependents(dynamicParamDependents, getWUModel()->getParamNames(), wuDerivedParams.nameBegin,
+                              getWUParamDynamic(), m_WUDerivedParamDependencies);
+    addDynamicParamDependents(dynamicParamDependents, getPSModel()->getParamNames(), psDerivedParams.nameBegin,
+                              getPSParamDynamic(), m_PSDerivedParamDependencies);
+    return dynamicParamDependents;
+}
+
+VarStorageType SynapseGroup::getWUVarStorageType(const std::string &var) const
+{
+    return m_WUVarStorageType[getWUModel()->getVarIndex(var)];
+}
+
+const std::vector<double> &SynapseGroup::getWUVarCodebook(const std::string &var) const
+{
+    return m_WUVarCodebooks[getWUModel()->getVarIndex(var)];
+}
+
+std::string SynapseGroup::getWUVarStorageTypeName(const std::string &var) const
+{
+    const size_t varIndex = getWUModel()->getVarIndex(var);
+    switch(m_WUVarStorageType[varIndex]) {
+    case VarStorageType::HALF:
+        return "Half";
+    case VarStorageType::BFLOAT16:
+        return "BFloat16";
+    case VarStorageType::CODEBOOK8:
+        return "Codebook<" + getWUModel()->getVars()[varIndex].second + ", " + var + "Codebook" + getName() + ", " + std::to_string(m_WUVarCodebooks[varIndex].size()) + ">";
+    default:
+        return getWUModel()->getVars()[varIndex].second;
+    }
+}
+
+bool SynapseGroup::isWUVarReducedPrecisionStorageRequired() const
+{
+    return std::any_of(m_WUVarStorageType.cbegin(), m_WUVarStorageType.cend(),
+                       [](VarStorageType type){ return (type != VarStorageType::DEFAULT); });
+}
+
+bool SynapseGroup::isSynapseIndex64BitRequired() const
+{
+    // **NOTE** YALE connectivity is stored in SparseProjection structures whose indices are 32-bit
+    if(getMatrixType() & SynapseMatrixConnectivity::YALE) {
+        return false;
+    }
+
+    const uint64_t numSrcNeurons = getSrcNeuronGroup()->getNumNeurons();
+    const uint64_t numTrgNeurons = getTrgNeuronGroup()->getNumNeurons();
+    if(getMatrixType() & SynapseMatrixConnectivity::RAGGED) {
+        // **NOTE** column-major remapping array is only allocated if there is postsynaptic learning
+        const uint64_t maxRowMajorSynapses = numSrcNeurons * getMaxConnections();
+        const uint64_t maxColMajorSynapses = getWUModel()->getLearnPostCode().empty() ? 0 : (numTrgNeurons * getMaxSourceConnections());
+        return (std::max(maxRowMajorSynapses, maxColMajorSynapses) > std::numeric_limits<unsigned int>::max());
+    }
+    else {
+        return ((numSrcNeurons * numTrgNeurons) > std::numeric_limits<unsigned int>::max());
+    }
+}
+
+std::string SynapseGroup::getSynapseIndexStride(unsigned int stride) const
+{
+    return std::to_string(stride) + (isSynapseIndex64BitRequired() ? "ull" : "");
+}
+
 VarMode SynapseGroup::getWUPreVarMode(const std::string &var) const
 {
     return m_WUPreVarMode[getWUModel()->getPreVarIndex(var)];
@@ -413,6 +685,18 @@ std::string SynapseGroup::getDendriticDelayOffset(const std::string &devPrefix,
     }
 }
 
+std::string SynapseGroup::getDendriticDelayAddCode(const std::string &postIdx) const
+{
+    assert(isDendriticDelayRequired());
+
+    if(isSparseDendriticDelayEnabled()) {
+        return "denDelayQueue" + getPSModelTargetName() + "[(denDelayPtr" + getPSModelTargetName() + " + $(1)) % " + to_string(getMaxDendriticDelayTimesteps()) + "].emplace_back(" + postIdx + ", $(0))";
+    }
+    else {
+        return "denDelay" + getPSModelTargetName() + "[" + getDendriticDelayOffset("", "$(1)") + postIdx + "] += $(0)";
+    }
+}
+
 bool SynapseGroup::isDendriticDelayRequired() const
 {
     // If addToInSynDelay function is used in sim code, return true
@@ -519,6 +803,13 @@ bool SynapseGroup::isDeviceSparseInitRequired() const
     return false;
 }
 
+bool SynapseGroup::isConnectivityFileLoadSupported() const
+{
+    return ((getMatrixType() & SynapseMatrixConnectivity::SPARSE) &&
+            (getSparseConnectivityVarMode() & VarLocation::HOST) &&
+            getConnectivityInitialiser().getSnippet()->getRowBuildCode().empty());
+}
+
 bool SynapseGroup::canRunOnCPU() const
 {
 #ifndef CPU_ONLY
@@ -165,6 +165,9 @@ size_t theSize(const string &type)
     else if (type == "curandState") return 44;
     else if (type == "curandStatePhilox4_32_10_t") return 64;
     else if (type == "scalar") return sizeof(float);
+    else if (type.compare(0, 11, "FixedPoint<") == 0) return sizeof(int32_t);
+    else if (type == "Half" || type == "BFloat16") return sizeof(uint16_t);
+    else if (type.compare(0, 9, "Codebook<") == 0) return sizeof(uint8_t);
     else return 0;
 }
 
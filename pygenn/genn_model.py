@@ -40,6 +40,7 @@ Example:
 """
 # python imports
 from os import path
+from platform import system
 from subprocess import check_call   # to call make
 from textwrap import dedent
 # 3rd party imports
@@ -101,6 +102,7 @@ class GeNNModel(object):
 
         self._built = False
         self._loaded = False
+        self._library_path = None
         self._localhost = genn_wrapper.initMPI_pygenn()
 
         self.use_cpu = cpu
@@ -334,11 +336,19 @@ class GeNNModel(object):
         self._path_to_model = path_to_model
 
         self._model.finalize()
-        genn_wrapper.generate_model_runner_pygenn(
-            self._model, self._path_to_model, self._localhost)
 
-        check_call(["make", "-C", path.join(path_to_model,
-                                            self.model_name + "_CODE")])
+        # On Windows, generate code and build it using the generated Makefile
+        if system() == "Windows":
+            genn_wrapper.generate_model_runner_pygenn(
+                self._model, self._path_to_model, self._localhost)
+
+            check_call(["make", "-C", path.join(path_to_model,
+                                                self.model_name + "_CODE")])
+        # Otherwise, build in-process, re-using previously compiled
+        # library if the generated code has not changed
+        else:
+            self._library_path = genn_wrapper.build_model_runner_pygenn(
+                self._model, self._path_to_model, self._localhost)
 
         self._built = True
 
@@ -350,7 +360,10 @@ class GeNNModel(object):
         if self._loaded:
             raise Exception("GeNN model already loaded")
 
-        self._slm.open(self._path_to_model, self.model_name)
+        if self._library_path is None:
+            self._slm.open(self._path_to_model, self.model_name)
+        else:
+            self._slm.open_library(self._library_path, self.model_name)
 
         self._slm.allocate_mem()
         self._slm.initialize()
@@ -73,10 +73,18 @@ public:
     bool open(const std::string &pathToModel, const std::string &modelName)
     {
 #ifdef _WIN32
-        const std::string libraryName = pathToModel + modelName + "_CODE\\runner.dll";
+        return openLibrary(pathToModel + modelName + "_CODE\\runner.dll", modelName);
+#else
+        return openLibrary(pathToModel + modelName + "_CODE/librunner.so", modelName);
+#endif
+    }
+
+    // Open model library at an explicit path e.g. one returned by build_model_runner
+    bool openLibrary(const std::string &libraryName, const std::string &modelName)
+    {
+#ifdef _WIN32
         m_Library = LoadLibrary(libraryName.c_str());
 #else
-        const std::string libraryName = pathToModel + modelName + "_CODE/librunner.so";
         m_Library = dlopen(libraryName.c_str(), RTLD_NOW);
 #endif
 
@@ -0,0 +1,46 @@
+//--------------------------------------------------------------------------
+/*! \file build_model_runner/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 1, 1);
+
+    SET_SIM_CODE("$(V) *= $(decay);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("false");
+
+    SET_PARAM_NAMES({"decay"});
+
+    SET_VARS({{"V", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+void defineModel(NNmodel &model, const std::string &name, double decay)
+{
+    model.setDT(1.0);
+    model.setName(name);
+
+    model.addNeuronPopulation<Neuron>("pop", 10, Neuron::ParamValues(decay), Neuron::VarValues(1.0));
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    defineModel(model, "build_model_runner_new", 0.5);
+}
@@ -0,0 +1,158 @@
+//--------------------------------------------------------------------------
+/*! \file build_model_runner/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+// Standard C++ includes
+#include <cmath>
+#include <cstdlib>
+
+// POSIX includes
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN includes
+#include "generateALL.h"
+#include "global.h"
+
+// PyGeNN includes
+#include "SharedLibraryModel.h"
+
+// Model definition
+#include "model_new.cc"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+const std::string modelName = "build_model_runner_lib";
+
+std::string buildModel(double decay)
+{
+    NNmodel model;
+    defineModel(model, modelName, decay);
+#ifndef CPU_ONLY
+    chooseDevice(model, ".", 0);
+#endif
+    return build_model_runner(model, ".", 0);
+}
+
+time_t getModificationTime(const std::string &filename)
+{
+    struct stat s;
+    if(stat(filename.c_str(), &s) != 0) {
+        return 0;
+    }
+    return s.st_mtime;
+}
+
+bool fileExists(const std::string &filename)
+{
+    return (access(filename.c_str(), F_OK) == 0);
+}
+}   // Anonymous namespace
+
+TEST(BuildModelRunner, BuildLoadAndCache)
+{
+    // Remove any libraries cached by previous runs
+    const std::string codePath = "./" + modelName + "_CODE/";
+    ASSERT_EQ(system(("rm -rf " + codePath).c_str()), 0);
+
+    // Build model and check preference it overrides has been restored
+    const std::string libraryPath = buildModel(0.5);
+    EXPECT_FALSE(GENN_PREFERENCES::buildSharedLibrary);
+    ASSERT_TRUE(fileExists(libraryPath));
+    EXPECT_NE(libraryPath.find(codePath + "librunner_"), std::string::npos);
+    const time_t libraryTime = getModificationTime(libraryPath);
+
+    // Load library and simulate
+    {
+        SharedLibraryModel<float> library;
+        ASSERT_TRUE(library.openLibrary(libraryPath, modelName));
+        library.initNeuronPopIO("pop");
+        library.allocateMem();
+        library.initialize();
+        library.initializeModel();
+        for(unsigned int i = 0; i < 10; i++) {
+#ifdef CPU_ONLY
+            library.stepTimeCPU();
+#else
+            library.stepTimeGPU();
+            library.pullStateFromDevice("pop");
+#endif
+        }
+
+        float *V = *static_cast<float**>(library.getSymbol("Vpop"));
+        for(unsigned int i = 0; i < 10; i++) {
+            ASSERT_FLOAT_EQ(V[i], std::pow(0.5f, 10.0f));
+        }
+    }
+
+    // Wait so any rebuild would be visible in the modification time
+    sleep(1);
+
+    // Rebuilding the unchanged model should return cached library without compiling anything
+    EXPECT_EQ(buildModel(0.5), libraryPath);
+    EXPECT_EQ(getModificationTime(libraryPath), libraryTime);
+    for(const char *o : {"runner.o", "sparseUtils.o", "init.o"}) {
+        EXPECT_FALSE(fileExists(codePath + o));
+    }
+
+    // Changing a parameter should result in a new library
+    const std::string changedLibraryPath = buildModel(0.25);
+    EXPECT_NE(changedLibraryPath, libraryPath);
+    EXPECT_TRUE(fileExists(changedLibraryPath));
+}
+
+#ifdef CPU_ONLY
+TEST(BuildModelRunner, ProfileGuidedOptimisation)
+{
+    const std::string codePath = "./" + modelName + "_CODE/";
+    ASSERT_EQ(system(("rm -rf " + codePath).c_str()), 0);
+
+    // Build instrumented library and run it to record a profile
+    // **NOTE** profile is written when library is unloaded
+    GENN_PREFERENCES::profileGuidedOptimisation = "generate";
+    const std::string generateLibraryPath = buildModel(0.5);
+    {
+        SharedLibraryModel<float> library;
+        ASSERT_TRUE(library.openLibrary(generateLibraryPath, modelName));
+        library.allocateMem();
+        library.initialize();
+        library.initializeModel();
+        for(unsigned int i = 0; i < 10; i++) {
+            library.stepTimeCPU();
+        }
+    }
+    ASSERT_EQ(system(("ls " + codePath + "pgo/*.gcda > /dev/null").c_str()), 0);
+
+    // Rebuild using profile and check result is distinct from the instrumented library
+    GENN_PREFERENCES::profileGuidedOptimisation = "use";
+    const std::string useLibraryPath = buildModel(0.5);
+    GENN_PREFERENCES::profileGuidedOptimisation = "";
+    EXPECT_NE(useLibraryPath, generateLibraryPath);
+    EXPECT_TRUE(fileExists(useLibraryPath));
+}
+#endif
+
+int main(int argc, char **argv)
+{
+#ifndef CPU_ONLY
+    CHECK_CUDA_ERRORS(cudaGetDeviceCount(&deviceCount));
+    deviceProp = new cudaDeviceProp[deviceCount];
+    for (int device = 0; device < deviceCount; device++) {
+        CHECK_CUDA_ERRORS(cudaSetDevice(device));
+        CHECK_CUDA_ERRORS(cudaGetDeviceProperties(&(deviceProp[device]), device));
+    }
+#endif
+    initGeNN();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,88 @@
+//--------------------------------------------------------------------------
+/*! \file connectivity_init_snippets/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("connectivity_init_snippets_new");
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);    // 0 - Wij (nA)
+
+    // Connectivity parameters
+    InitSparseConnectivitySnippet::FixedNumberPostWithReplacement::ParamValues fixedNumberPostParams(
+        10.0);  // 0 - Row length
+    InitSparseConnectivitySnippet::FixedNumberTotalWithReplacement::ParamValues fixedNumberTotalParams(
+        1000.0);    // 0 - Total number of synapses
+    InitSparseConnectivitySnippet::SpatialGaussian2D::ParamValues spatial2DParams(
+        1.0,    // 0 - Probability of connection at zero distance
+        1.0E6,  // 1 - Width of Gaussian
+        1.5,    // 2 - Maximum distance
+        10.0,   // 3 - Width of presynaptic grid
+        1.0,    // 4 - Spacing of presynaptic grid
+        10.0,   // 5 - Width of postsynaptic grid
+        1.0);   // 6 - Spacing of postsynaptic grid
+    InitSparseConnectivitySnippet::SpatialGaussian3D::ParamValues spatial3DParams(
+        1.0,    // 0 - Probability of connection at zero distance
+        1.0E6,  // 1 - Width of Gaussian
+        1.0,    // 2 - Maximum distance
+        5.0,    // 3 - Width of presynaptic grid
+        5.0,    // 4 - Height of presynaptic grid
+        1.0,    // 5 - Spacing of presynaptic grid
+        5.0,    // 6 - Width of postsynaptic grid
+        5.0,    // 7 - Height of postsynaptic grid
+        1.0);   // 8 - Spacing of postsynaptic grid
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 100, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 100, {}, Neuron::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "FixedNumberPost", SynapseMatrixType::RAGGED_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedNumberPostWithReplacement>(fixedNumberPostParams));
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "FixedNumberTotal", SynapseMatrixType::RAGGED_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedNumberTotalWithReplacement>(fixedNumberTotalParams));
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Spatial2D", SynapseMatrixType::RAGGED_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::SpatialGaussian2D>(spatial2DParams));
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Spatial3D", SynapseMatrixType::RAGGED_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::SpatialGaussian3D>(spatial3DParams));
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
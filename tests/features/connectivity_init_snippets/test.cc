@@ -0,0 +1,121 @@
+//--------------------------------------------------------------------------
+/*! \file connectivity_init_snippets/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+// Standard C++ includes
+#include <algorithm>
+#include <numeric>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Squared distance between neurons i and j laid out in row-major order on a grid with unit spacing and width x height layers
+double getDistanceSq(unsigned int i, unsigned int j, unsigned int width, unsigned int height)
+{
+    const unsigned int layerSize = width * height;
+    const double dX = (double)(j % width) - (double)(i % width);
+    const double dY = (double)((j % layerSize) / width) - (double)((i % layerSize) / width);
+    const double dZ = (double)(j / layerSize) - (double)(i / layerSize);
+    return (dX * dX) + (dY * dY) + (dZ * dZ);
+}
+
+// Count neurons on a width x height x depth grid with unit spacing within maxDistance of neuron i
+unsigned int countNeighbours(unsigned int i, unsigned int width, unsigned int height, unsigned int num, double maxDistance)
+{
+    unsigned int count = 0;
+    for(unsigned int j = 0; j < num; j++) {
+        if(getDistanceSq(i, j, width, height) <= (maxDistance * maxDistance)) {
+            count++;
+        }
+    }
+    return count;
+}
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+};
+
+TEST_P(SimTest, FixedNumberPost)
+{
+    for(unsigned int i = 0; i < 100; i++) {
+        // Every row should have exactly the requested number of synapses, sorted by postsynaptic index
+        ASSERT_EQ(CFixedNumberPost.rowLength[i], 10);
+
+        const unsigned int *rowBegin = &CFixedNumberPost.ind[i * CFixedNumberPost.maxRowLength];
+        ASSERT_TRUE(std::is_sorted(rowBegin, rowBegin + 10));
+        ASSERT_LT(rowBegin[9], 100);
+    }
+}
+
+TEST_P(SimTest, FixedNumberTotal)
+{
+    // Total number of synapses should match
+    const unsigned int total = std::accumulate(&CFixedNumberTotal.rowLength[0], &CFixedNumberTotal.rowLength[100], 0u);
+    ASSERT_EQ(total, 1000);
+
+    for(unsigned int i = 0; i < 100; i++) {
+        const unsigned int rowLength = CFixedNumberTotal.rowLength[i];
+        ASSERT_LE(rowLength, CFixedNumberTotal.maxRowLength);
+
+        const unsigned int *rowBegin = &CFixedNumberTotal.ind[i * CFixedNumberTotal.maxRowLength];
+        ASSERT_TRUE(std::is_sorted(rowBegin, rowBegin + rowLength));
+    }
+}
+
+TEST_P(SimTest, Spatial2D)
+{
+    // Bound should be exact - a neuron away from the edges connects to itself and its 8 neighbours
+    ASSERT_EQ(CSpatial2D.maxRowLength, 9);
+
+    // With a probability of 1 and a very wide Gaussian every neuron within range should be connected
+    for(unsigned int i = 0; i < 100; i++) {
+        ASSERT_EQ(CSpatial2D.rowLength[i], countNeighbours(i, 10, 10, 100, 1.5));
+
+        for(unsigned int s = 0; s < CSpatial2D.rowLength[i]; s++) {
+            const unsigned int j = CSpatial2D.ind[(i * CSpatial2D.maxRowLength) + s];
+            ASSERT_LE(getDistanceSq(i, j, 10, 10), 1.5 * 1.5);
+        }
+    }
+}
+
+TEST_P(SimTest, Spatial3D)
+{
+    // Bound should be exact - a neuron away from the edges connects to itself and its 6 face neighbours
+    ASSERT_EQ(CSpatial3D.maxRowLength, 7);
+
+    for(unsigned int i = 0; i < 100; i++) {
+        ASSERT_EQ(CSpatial3D.rowLength[i], countNeighbours(i, 5, 5, 100, 1.0));
+
+        for(unsigned int s = 0; s < CSpatial3D.rowLength[i]; s++) {
+            const unsigned int j = CSpatial3D.ind[(i * CSpatial3D.maxRowLength) + s];
+            ASSERT_LE(getDistanceSq(i, j, 5, 5), 1.0);
+        }
+    }
+}
+
+// **NOTE** FixedNumberTotalWithReplacement can only be initialised on the host
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
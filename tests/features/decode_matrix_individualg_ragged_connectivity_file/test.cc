@@ -0,0 +1,76 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_individualg_ragged_connectivity_file/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test_decoder_matrix.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestDecoderMatrix
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Build decoder connectivity in row-major form
+        std::vector<uint64_t> rowStart{0};
+        std::vector<uint32_t> ind;
+        for(unsigned int i = 0; i < 10; i++)
+        {
+            for(unsigned int j = 0; j < 4; j++)
+            {
+                // Get value this post synaptic neuron represents
+                const unsigned int j_value = (1 << j);
+
+                // If this postsynaptic neuron should be connected, add index
+                if(((i + 1) & j_value) != 0)
+                {
+                    ind.push_back(j);
+                }
+            }
+            rowStart.push_back(ind.size());
+        }
+
+        // Write connectivity with double precision weights and load it back
+        const std::vector<double> weights(ind.size(), 1.0);
+        ConnectivityFile::write("decoder.conn", 10, 4, rowStart, ind, weights, true);
+        loadSynConnectivity("decoder.conn");
+    }
+};
+
+TEST_P(SimTest, CorrectDecoding)
+{
+#ifndef CPU_ONLY
+    // Initialize sparse arrays
+    initializeAllSparseArrays();
+#endif  // CPU_ONLY
+
+    // Check total error is less than some tolerance
+    EXPECT_TRUE(Simulate());
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,72 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_individualg_ragged_delta/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test_decoder_matrix.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestDecoderMatrix
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Loop through presynaptic neurons
+        for(unsigned int i = 0; i < 10; i++)
+        {
+            // Initially zero row length
+            CSyn.rowLength[i] = 0;
+            for(unsigned int j = 0; j < 4; j++)
+            {
+                // Get value this post synaptic neuron represents
+                const unsigned int j_value = (1 << j);
+
+                // If this postsynaptic neuron should be connected, add index
+                if(((i + 1) & j_value) != 0)
+                {
+                    const unsigned int idx = (i * 4) + CSyn.rowLength[i]++;
+                    CSyn.ind[idx] = j;
+                    gSyn[idx] = 1.0f;
+                }
+            }
+        }
+
+        // Delta-encode connectivity
+        initdecode_matrix_individualg_ragged_delta_new();
+    }
+};
+
+TEST_P(SimTest, CorrectDecoding)
+{
+#ifndef CPU_ONLY
+    // Initialize sparse arrays
+    initializeAllSparseArrays();
+#endif  // CPU_ONLY
+
+    // Check total error is less than some tolerance
+    EXPECT_TRUE(Simulate());
+}
+
+// **NOTE** delta-encoded connectivity is only supported in CPU_ONLY mode
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
\ No newline at end of file
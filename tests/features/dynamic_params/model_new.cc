@@ -0,0 +1,86 @@
+//--------------------------------------------------------------------------
+/*! \file dynamic_params/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 2, 2);
+
+    SET_SIM_CODE(
+        "$(x) = $(a) + $(b) + $(d);\n"
+        "$(input) = $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("false");
+
+    SET_PARAM_NAMES({"a", "c"});
+
+    SET_DERIVED_PARAMS({
+        {"b", [](const vector<double> &pars, double){ return 2.0 * pars[0]; }},
+        {"d", [](const vector<double> &pars, double){ return 3.0 * pars[1]; }}});
+
+    SET_VARS({{"x", "scalar"}, {"input", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(WeightUpdateModel, 1, 0, 0, 0);
+
+    SET_PARAM_NAMES({"w"});
+
+    SET_SIM_CODE("$(addToInSyn, $(w));\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(NNmodel &model)
+{
+    // Turn off auto refractory logic so neurons can spike every time they are updated
+    GENN_PREFERENCES::autoRefractory = false;
+
+    initGeNN();
+    model.setDT(1.0);
+    model.setName("dynamic_params_new");
+
+    model.addNeuronPopulation<PreNeuron>("pre", 10, {}, {});
+    auto *post = model.addNeuronPopulation<PostNeuron>("post", 10, PostNeuron::ParamValues(1.0, 1.0), PostNeuron::VarValues(0.0, 0.0));
+    post->setParamDynamic("a");
+
+    auto *syn = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "syn", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "pre", "post",
+        WeightUpdateModel::ParamValues(0.5), {},
+        {}, {});
+    syn->setWUParamDynamic("w");
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
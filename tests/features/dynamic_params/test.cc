@@ -0,0 +1,61 @@
+//--------------------------------------------------------------------------
+/*! \file dynamic_params/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+public:
+    void Simulate()
+    {
+        while(iT < 20) {
+            // Half way through, change dynamic parameter values
+            // **NOTE** derived parameter b = 2a depends on a so its new value is passed alongside it
+            if(iT == 10) {
+                const scalar a = 2.0f;
+                setapost(a, 2.0f * a);
+                setwsyn(1.0f);
+            }
+
+            StepGeNN();
+
+            // Derived parameter d depends only on static parameter c so is unaffected
+            const bool changed = (iT > 10);
+            for(unsigned int i = 0; i < 10; i++) {
+                ASSERT_FLOAT_EQ(xpost[i], changed ? 9.0f : 6.0f);
+
+                // **NOTE** spikes emitted on first timestep are delivered on the second
+                ASSERT_FLOAT_EQ(inputpost[i], (iT > 1) ? (changed ? 10.0f : 5.0f) : 0.0f);
+            }
+        }
+    }
+};
+
+TEST_P(SimTest, AcceptableError)
+{
+    Simulate();
+}
+
+// **NOTE** dynamic parameters are only tested on the CPU
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,65 @@
+//--------------------------------------------------------------------------
+/*! \file fixed_point_precision/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 1, 3);
+
+    SET_SIM_CODE(
+        "$(V) += $(Isyn);\n"
+        "$(x) += DT * $(rate);\n"
+        "$(y) = fminf(expf($(V) * 0.0f), 2.0f);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("false");
+
+    SET_PARAM_NAMES({"rate"});
+    SET_VARS({{"V", "scalar"}, {"x", "scalar"}, {"y", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+void modelDefinition(NNmodel &model)
+{
+    // Turn off auto refractory logic so pre neuron can spike every timestep
+    GENN_PREFERENCES::autoRefractory = false;
+
+    initGeNN();
+    model.setDT(1.0);
+    model.setName("fixed_point_precision_new");
+
+    model.addNeuronPopulation<PreNeuron>("pre", 10, {}, {});
+    model.addNeuronPopulation<PostNeuron>("post", 10, PostNeuron::ParamValues(5000.0), PostNeuron::VarValues(0.0, 0.0, 0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "syn", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.1),
+        {}, {});
+
+    model.setPrecision(GENN_FIXED_Q16_16);
+    model.finalize();
+}
@@ -0,0 +1,59 @@
+//--------------------------------------------------------------------------
+/*! \file fixed_point_precision/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+public:
+    void Simulate()
+    {
+        // 0.1 rounds to 6554 / 65536 in Q16.16
+        ASSERT_EQ(gsyn[0].getRaw(), 6554);
+
+        while(iT < 20) {
+            StepGeNN();
+
+            for(unsigned int i = 0; i < 10; i++) {
+                // Input from 10 presynaptic neurons is delivered every timestep after the first
+                // and should be accumulated exactly, without any floating point rounding
+                ASSERT_EQ(Vpost[i].getRaw(), (int32_t)(10 * 6554 * (iT - 1)));
+
+                // Integrating rate should saturate rather than wrap around
+                const int64_t x = 5000ll * 65536ll * (int64_t)iT;
+                ASSERT_EQ(xpost[i].getRaw(), (int32_t)std::min<int64_t>(x, INT32_MAX));
+
+                ASSERT_EQ((double)ypost[i], 1.0);
+            }
+        }
+    }
+};
+
+TEST_P(SimTest, AcceptableError)
+{
+    Simulate();
+}
+
+// **NOTE** fixed-point precision is only implemented on the CPU
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
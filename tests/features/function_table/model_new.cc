@@ -0,0 +1,48 @@
+//--------------------------------------------------------------------------
+/*! \file function_table/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 3);
+
+    SET_SIM_CODE(
+        "$(x) = exp(($(t) * 0.1) - 1.0);\n"
+        "$(y) = tanh(($(t) * 0.1) - 1.0);\n"
+        "$(z) = sigmoid(($(t) * 0.1) - 1.0);\n");
+
+    SET_SUPPORT_CODE("__device__ __host__ scalar sigmoid(scalar v){ return 1.0 / (1.0 + exp(-v)); }");
+
+    SET_VARS({{"x", "scalar"}, {"y", "scalar"}, {"z", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    model.setDT(1.0);
+    model.setName("function_table_new");
+
+    auto *pop = model.addNeuronPopulation<Neuron>("pop", 10, {}, Neuron::VarValues(0.0, 0.0, 0.0));
+
+    // Arguments above 0.5 fall outside the exp table and are passed through to exp
+    pop->setFunctionTable("exp", -2.0, 0.5, 50);
+    pop->setFunctionTable("tanh", -2.0, 2.0, 32, FunctionTable::Interpolation::CUBIC);
+    pop->setFunctionTable("sigmoid", [](double v){ return 1.0 / (1.0 + std::exp(-v)); },
+                          -2.0, 2.0, 32, FunctionTable::Interpolation::CUBIC);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
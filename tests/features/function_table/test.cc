@@ -0,0 +1,54 @@
+//--------------------------------------------------------------------------
+/*! \file function_table/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+public:
+    void Simulate()
+    {
+        while(iT < 20) {
+            StepGeNN();
+
+            // Neurons were updated with the time at the start of the timestep
+            const double v = ((t - DT) * 0.1) - 1.0;
+            for(unsigned int i = 0; i < 10; i++) {
+                ASSERT_NEAR(xpop[i], std::exp(v), 1E-3);
+                ASSERT_NEAR(ypop[i], std::tanh(v), 1E-4);
+                ASSERT_NEAR(zpop[i], 1.0 / (1.0 + std::exp(-v)), 1E-4);
+            }
+        }
+    }
+};
+
+TEST_P(SimTest, AcceptableError)
+{
+    Simulate();
+}
+
+// **NOTE** tables are only used on the CPU
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
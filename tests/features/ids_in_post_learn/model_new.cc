@@ -0,0 +1,67 @@
+//--------------------------------------------------------------------------
+/*! \file ids_in_post_learn/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+//! Neuron which spikes every other timestep
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(t);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("(fmod($(x), 2.0) < 0.5)");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"w", "scalar"}});
+
+    SET_LEARN_POST_CODE("$(w)= ($(id_pre) * 100) + $(id_post);");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    model.setDT(1.0);
+    model.setName("ids_in_post_learn_new");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("pre", 10, {}, {});
+    model.addNeuronPopulation<Neuron>("post", 10, {}, Neuron::VarValues(1.0));
+
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "ragged", SynapseMatrixType::RAGGED_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>({}));
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,64 @@
+//--------------------------------------------------------------------------
+/*! \file ids_in_post_learn/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+public:
+    void Simulate()
+    {
+        // Postsynaptic neurons all spike in the first timestep so learning code runs in the second
+        while(iT < 2) {
+            StepGeNN();
+        }
+
+#ifndef CPU_ONLY
+        if(GetParam()) {
+            pulldenseStateFromDevice();
+            pullraggedStateFromDevice();
+        }
+#endif
+
+        for(unsigned int i = 0; i < 10; i++) {
+            for(unsigned int j = 0; j < 10; j++) {
+                ASSERT_FLOAT_EQ(wdense[(i * 10) + j], (float)((i * 100) + j));
+            }
+
+            // **NOTE** one-to-one connectivity means each row contains a single synapse
+            ASSERT_FLOAT_EQ(wragged[i], (float)((i * 100) + i));
+        }
+    }
+};
+
+TEST_P(SimTest, AcceptableError)
+{
+    Simulate();
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
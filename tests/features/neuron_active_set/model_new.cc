@@ -0,0 +1,88 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_active_set/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("fabs($(t) - (scalar)$(id)) < 1e-4");
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 2);
+
+    SET_SIM_CODE(
+        "$(numUpdates) += 1.0;\n"
+        "$(V) = ($(V) + $(Isyn)) * 0.5;\n"
+        "if(fabs($(V)) < 1e-3) {\n"
+        "   $(V) = 0.0;\n"
+        "}\n");
+
+    SET_THRESHOLD_CONDITION_CODE("false");
+
+    SET_REST_CONDITION_CODE("$(V) == 0.0");
+
+    SET_VARS({{"V", "scalar"}, {"numUpdates", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//----------------------------------------------------------------------------
+// PulseSource
+//----------------------------------------------------------------------------
+class PulseSource : public CurrentSourceModels::Base
+{
+public:
+    DECLARE_MODEL(PulseSource, 0, 0);
+
+    SET_INJECTION_CODE(
+        "if(fabs($(t) - (30.0 + (scalar)$(id))) < 1e-4) {\n"
+        "   $(injectCurrent, 2.0);\n"
+        "}\n");
+};
+
+IMPLEMENT_MODEL(PulseSource);
+
+void modelDefinition(NNmodel &model)
+{
+    // Turn off auto refractory logic so pre neuron threshold condition can be based on time alone
+    GENN_PREFERENCES::autoRefractory = false;
+
+    initGeNN();
+    model.setDT(1.0);
+    model.setName("neuron_active_set_new");
+
+    model.addNeuronPopulation<PreNeuron>("pre", 10, {}, {});
+    auto *post = model.addNeuronPopulation<PostNeuron>("post", 10, {}, PostNeuron::VarValues(0.0, 0.0));
+    post->setActiveSetUpdateEnabled(true);
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "syn", SynapseMatrixType::RAGGED_GLOBALG, NO_DELAY, "pre", "post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>({}));
+
+    model.addCurrentSource<PulseSource>("pulse", "post", {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
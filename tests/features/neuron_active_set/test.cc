@@ -0,0 +1,76 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_active_set/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+public:
+    void Simulate()
+    {
+        while(iT < 50) {
+            StepGeNN();
+        }
+
+        // Loop through postsynaptic neurons
+        for(unsigned int j = 0; j < 10; j++) {
+            // Reproduce postsynaptic neuron's dynamics, skipping timesteps when it is at rest
+            // **NOTE** all neurons start in the active set so are updated in the first timestep
+            // **NOTE** spike emitted by presynaptic neuron j at timestep j is received in timestep j + 1
+            // and the current source injects a pulse into postsynaptic neuron j in timestep 30 + j
+            float v = 0.0f;
+            float numUpdates = 0.0f;
+            for(unsigned int s = 0; s < 50; s++) {
+                const float input = (s == (j + 1)) ? 1.0f : ((s == (30 + j)) ? 2.0f : 0.0f);
+                if(s > 0 && v == 0.0f && input == 0.0f) {
+                    continue;
+                }
+
+                numUpdates += 1.0f;
+                v = (v + input) * 0.5f;
+                if(std::fabs(v) < 1e-3f) {
+                    v = 0.0f;
+                }
+            }
+
+            ASSERT_FLOAT_EQ(Vpost[j], v);
+            ASSERT_FLOAT_EQ(numUpdatespost[j], numUpdates);
+            ASSERT_LT(numUpdatespost[j], 50.0f);
+        }
+
+        // All neurons are back at rest so should have left the active set
+        ASSERT_EQ(activeMaskpost[0], 0);
+    }
+};
+
+TEST_P(SimTest, AcceptableError)
+{
+    Simulate();
+}
+
+// **NOTE** active-set neuron updates are only implemented on the CPU
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,110 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_update_interval/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// SlowNeuron
+//----------------------------------------------------------------------------
+class SlowNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(SlowNeuron, 0, 3);
+
+    SET_SIM_CODE(
+        "$(x) += DT;\n"
+        "$(updateDT) = $(stepDT);\n"
+        "$(input) += $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+
+    SET_DERIVED_PARAMS({{"stepDT", [](const vector<double> &, double dt){ return dt; }}});
+
+    SET_VARS({{"x", "scalar"}, {"updateDT", "scalar"}, {"input", "scalar"}});
+};
+
+IMPLEMENT_MODEL(SlowNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 1);
+
+    SET_SIM_CODE("$(input) += $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("false");
+
+    SET_VARS({{"input", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"c", "scalar"}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(c) += DT;\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(NNmodel &model)
+{
+    // Turn off auto refractory logic so neurons can spike every time they are updated
+    GENN_PREFERENCES::autoRefractory = false;
+
+    initGeNN();
+    model.setDT(1.0);
+    model.setName("neuron_update_interval_new");
+
+    model.addNeuronPopulation<PreNeuron>("pre", 10, {}, {});
+    auto *slow = model.addNeuronPopulation<SlowNeuron>("slow", 10, {}, SlowNeuron::VarValues(0.0, 0.0, 0.0));
+    slow->setUpdateInterval(4);
+    model.addNeuronPopulation<PostNeuron>("post", 10, {}, PostNeuron::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "preSlow", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "pre", "slow",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.0),
+        {}, {});
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "slowPost", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "slow", "post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.0),
+        {}, {});
+
+    auto *dyn = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "dyn", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+    dyn->setSynapseDynamicsUpdateInterval(3);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,74 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_update_interval/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+public:
+    void Simulate()
+    {
+        while(iT < 100) {
+            StepGeNN();
+
+            // Timestep that has just been simulated
+            const unsigned int step = iT - 1;
+
+            // Slow neurons are updated on every 4th timestep
+            const unsigned int numSlowUpdates = (step / 4) + 1;
+            const unsigned int lastSlowUpdate = (numSlowUpdates - 1) * 4;
+            const unsigned int expectedSpikeCount = ((step % 4) == 0) ? 10 : 0;
+            ASSERT_EQ(glbSpkCntslow[0], expectedSpikeCount);
+
+            // Spikes emitted by slow neurons are delivered once, on the timestep after each update
+            const unsigned int numSlowDeliveries = (step == 0) ? 0 : (((step - 1) / 4) + 1);
+
+            // Synapse dynamics are applied on every 3rd timestep
+            const unsigned int numDynUpdates = (step / 3) + 1;
+
+            for(unsigned int i = 0; i < 10; i++) {
+                // DT and derived parameters should be scaled by update interval
+                ASSERT_FLOAT_EQ(xslow[i], 4.0f * (float)numSlowUpdates);
+                ASSERT_FLOAT_EQ(updateDTslow[i], 4.0f);
+
+                // Input delivered by 10 presynaptic neurons every timestep should have accumulated between updates
+                ASSERT_FLOAT_EQ(inputslow[i], 10.0f * (float)lastSlowUpdate);
+
+                ASSERT_FLOAT_EQ(inputpost[i], 10.0f * (float)numSlowDeliveries);
+
+                for(unsigned int j = 0; j < 10; j++) {
+                    ASSERT_FLOAT_EQ(cdyn[(i * 10) + j], 3.0f * (float)numDynUpdates);
+                }
+            }
+        }
+    }
+};
+
+TEST_P(SimTest, AcceptableError)
+{
+    Simulate();
+}
+
+// **NOTE** update intervals are only implemented on the CPU
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
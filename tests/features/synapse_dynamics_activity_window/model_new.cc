@@ -0,0 +1,68 @@
+//--------------------------------------------------------------------------
+/*! \file synapse_dynamics_activity_window/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("$(t) >= (scalar)$(id) && fmodf($(t) - (scalar)$(id), 10.0f)< 1e-4");
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"c", "scalar"}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(c) += 1.0;\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(NNmodel &model)
+{
+    // Turn off auto refractory logic so pre neuron threshold condition can be based on time alone
+    GENN_PREFERENCES::autoInitSparseVars = true;
+    GENN_PREFERENCES::autoRefractory = false;
+
+    initGeNN();
+    model.setDT(1.0);
+    model.setName("synapse_dynamics_activity_window_new");
+
+    model.addNeuronPopulation<PreNeuron>("pre", 10, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("post", 10, {}, {});
+
+    auto *dense = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+    dense->setSynapseDynamicsActivityWindow(3);
+
+    auto *ragged = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "ragged", SynapseMatrixType::RAGGED_INDIVIDUALG, 5, "pre", "post",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>({}));
+    ragged->setSynapseDynamicsActivityWindow(3);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,75 @@
+//--------------------------------------------------------------------------
+/*! \file synapse_dynamics_activity_window/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+public:
+    // Count the number of timesteps in which presynaptic neuron i had spiked within the
+    // activity window of the spikes being delivered (emitted delay + 1 timesteps earlier)
+    static float getNumActiveSteps(unsigned int i, unsigned int delay, unsigned int numSteps)
+    {
+        unsigned int numActive = 0;
+        for(unsigned int s = 0; s < numSteps; s++) {
+            for(unsigned int w = 0; w < 3; w++) {
+                const int p = (int)s - (int)delay - 1 - (int)w;
+                if(p >= (int)i && ((p - i) % 10) == 0) {
+                    numActive++;
+                    break;
+                }
+            }
+        }
+        return (float)numActive;
+    }
+
+    void Simulate()
+    {
+        while(iT < 200) {
+            StepGeNN();
+        }
+
+        // Loop through presynaptic neurons
+        for(unsigned int i = 0; i < 10; i++) {
+            // Every synapse in row of dense matrix should have been updated when row was active
+            const float denseNumActive = getNumActiveSteps(i, 0, 200);
+            for(unsigned int j = 0; j < 10; j++) {
+                ASSERT_FLOAT_EQ(cdense[(i * 10) + j], denseNumActive);
+            }
+
+            // Single synapse in row of delayed ragged matrix should have been
+            // updated when row was active, taking into account axonal delay
+            ASSERT_EQ(Cragged.rowLength[i], 1);
+            ASSERT_FLOAT_EQ(cragged[i], getNumActiveSteps(i, 5, 200));
+        }
+    }
+};
+
+TEST_P(SimTest, AcceptableError)
+{
+    Simulate();
+}
+
+// **NOTE** activity gating of synapse dynamics is only implemented on the CPU
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,65 @@
+//--------------------------------------------------------------------------
+/*! \file synapse_dynamics_skip_mask/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Diagonal
+//----------------------------------------------------------------------------
+//! Initialises every third diagonal to one and everything else to zero
+class Diagonal : public InitVarSnippet::Base
+{
+public:
+    DECLARE_SNIPPET(Diagonal, 0);
+
+    SET_CODE("$(value) = ((($(id_pre) + $(id_post)) % 3) == 0) ? 1.0 : 0.0;");
+};
+IMPLEMENT_SNIPPET(Diagonal);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 2);
+
+    SET_VARS({{"g", "scalar"}, {"c", "scalar"}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(c) += 1.0;\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    model.setDT(1.0);
+    model.setName("synapse_dynamics_skip_mask_new");
+
+    // **NOTE** postsynaptic population is larger than 32 so rows of mask span multiple words
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("pre", 10, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("post", 40, {}, {});
+
+    WeightUpdateModel::VarValues varValues(initVar<Diagonal>(), 0.0);
+
+    auto *masked = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "masked", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, varValues,
+        {}, {});
+    masked->setSynapseDynamicsSkipMaskVar("g");
+
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "unmasked", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, varValues,
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
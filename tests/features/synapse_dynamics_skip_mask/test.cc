@@ -0,0 +1,56 @@
+//--------------------------------------------------------------------------
+/*! \file synapse_dynamics_skip_mask/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+public:
+    void Simulate()
+    {
+        while(iT < 20) {
+            StepGeNN();
+        }
+
+        for(unsigned int i = 0; i < 10; i++) {
+            for(unsigned int j = 0; j < 40; j++) {
+                const unsigned int s = (i * 40) + j;
+
+                // Synapses with zero weight should only be updated if they aren't masked
+                const bool nonZero = (((i + j) % 3) == 0);
+                ASSERT_FLOAT_EQ(gmasked[s], nonZero ? 1.0f : 0.0f);
+                ASSERT_FLOAT_EQ(cmasked[s], nonZero ? 20.0f : 0.0f);
+                ASSERT_FLOAT_EQ(cunmasked[s], 20.0f);
+            }
+        }
+    }
+};
+
+TEST_P(SimTest, AcceptableError)
+{
+    Simulate();
+}
+
+// **NOTE** synapse dynamics skip masks are only implemented on the CPU
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,73 @@
+//--------------------------------------------------------------------------
+/*! \file wu_var_codebook/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 1);
+
+    SET_SIM_CODE("$(input) = $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("false");
+
+    SET_VARS({{"input", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+void modelDefinition(NNmodel &model)
+{
+    // Turn off auto refractory logic so neurons can spike every time they are updated
+    GENN_PREFERENCES::autoRefractory = false;
+    GENN_PREFERENCES::autoInitSparseVars = true;
+
+    initGeNN();
+    model.setDT(1.0);
+    model.setName("wu_var_codebook_new");
+
+    model.addNeuronPopulation<PreNeuron>("pre", 10, {}, {});
+    model.addNeuronPopulation<PostNeuron>("post", 10, {}, PostNeuron::VarValues(0.0));
+
+    InitVarSnippet::Uniform::ParamValues uniformParams(
+        0.0,    // 0 - min
+        1.0);   // 1 - max
+    auto *dense = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(initVar<InitVarSnippet::Uniform>(uniformParams)),
+        {}, {});
+    dense->setWUVarCodebook("g", {1.0, 0.75, 0.5, 0.25, 0.0});
+
+    auto *ragged = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "ragged", SynapseMatrixType::RAGGED_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.3),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>({}));
+    ragged->setWUVarCodebook("g", {0.25, 0.5});
+
+    model.setPrecision(GENN_DOUBLE);
+    model.finalize();
+}
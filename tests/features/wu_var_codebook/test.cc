@@ -0,0 +1,71 @@
+//--------------------------------------------------------------------------
+/*! \file wu_var_codebook/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+// Standard C++ includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+public:
+    void Simulate()
+    {
+        // Weights should be stored as single byte indices into the codebook
+        ASSERT_EQ(sizeof(gdense[0]), 1);
+        ASSERT_EQ(sizeof(gragged[0]), 1);
+
+        // Uniformly distributed weights should be replaced by the nearest codebook entries
+        double expectedInput[10] = {0.0};
+        for(unsigned int i = 0; i < 10; i++) {
+            for(unsigned int j = 0; j < 10; j++) {
+                const double g = gdense[(i * 10) + j];
+                ASSERT_EQ(std::fmod(g, 0.25), 0.0);
+                ASSERT_GE(g, 0.0);
+                ASSERT_LE(g, 1.0);
+                expectedInput[j] += g;
+            }
+
+            // 0.3 is closer to 0.25 than 0.5
+            ASSERT_EQ((double)gragged[i], 0.25);
+            expectedInput[i] += 0.25;
+        }
+
+        while(iT < 20) {
+            StepGeNN();
+
+            // **NOTE** spikes emitted on first timestep are delivered on the second
+            for(unsigned int i = 0; i < 10; i++) {
+                ASSERT_DOUBLE_EQ(inputpost[i], (iT > 1) ? expectedInput[i] : 0.0);
+            }
+        }
+    }
+};
+
+TEST_P(SimTest, AcceptableError)
+{
+    Simulate();
+}
+
+// **NOTE** codebook storage is only implemented on the CPU
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,85 @@
+//--------------------------------------------------------------------------
+/*! \file wu_var_storage_type/model_new.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 1);
+
+    SET_SIM_CODE("$(input) = $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("false");
+
+    SET_VARS({{"input", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"c", "scalar"}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(c) = fmin($(c), 255.0) + 1.0;\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(NNmodel &model)
+{
+    // Turn off auto refractory logic so neurons can spike every time they are updated
+    GENN_PREFERENCES::autoRefractory = false;
+    GENN_PREFERENCES::autoInitSparseVars = true;
+
+    initGeNN();
+    model.setDT(1.0);
+    model.setName("wu_var_storage_type_new");
+
+    model.addNeuronPopulation<PreNeuron>("pre", 10, {}, {});
+    model.addNeuronPopulation<PostNeuron>("post", 10, {}, PostNeuron::VarValues(0.0));
+
+    auto *half = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "half", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.1),
+        {}, {});
+    half->setWUVarStorageType("g", VarStorageType::HALF);
+
+    auto *bfloat16 = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "bfloat16", SynapseMatrixType::RAGGED_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, WeightUpdateModel::VarValues(250.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>({}));
+    bfloat16->setWUVarStorageType("c", VarStorageType::BFLOAT16);
+
+    model.setPrecision(GENN_DOUBLE);
+    model.finalize();
+}
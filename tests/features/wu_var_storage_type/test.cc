@@ -0,0 +1,62 @@
+//--------------------------------------------------------------------------
+/*! \file wu_var_storage_type/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+// Standard C++ includes
+#include <algorithm>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestModern
+{
+public:
+    void Simulate()
+    {
+        // 0.1 rounded to the nearest half precision value
+        const double halfWeight = 0.0999755859375;
+
+        while(iT < 20) {
+            StepGeNN();
+
+            for(unsigned int i = 0; i < 10; i++) {
+                // Input from 10 presynaptic neurons should use rounded weights
+                // **NOTE** spikes emitted on first timestep are delivered on the second
+                ASSERT_EQ(inputpost[i], (iT > 1) ? (10.0 * halfWeight) : 0.0);
+
+                for(unsigned int j = 0; j < 10; j++) {
+                    ASSERT_EQ(ghalf[(i * 10) + j], halfWeight);
+                }
+
+                // Above 256, the spacing between bfloat16 values is 2 so incrementing by 1 rounds back to 256
+                ASSERT_EQ(cbfloat16[i], std::min(250.0 + (double)iT, 256.0));
+            }
+        }
+    }
+};
+
+TEST_P(SimTest, AcceptableError)
+{
+    Simulate();
+}
+
+// **NOTE** reduced precision storage is only implemented on the CPU
+auto simulatorBackends = ::testing::Values(false);
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
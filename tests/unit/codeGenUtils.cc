@@ -48,6 +48,25 @@ TEST(EnsureMathFunctionFtype, rint) {
     ASSERT_EQ(substitutedCode, "$(value) = (uint8_t)rintf(normal / DT);");
 }
 
+TEST(HoistInvariantExpressions, SharedInvariantCalls) {
+    std::string code = "lV += expf(-DT / 20.0f) * lI + expf( -DT/20.0f ) + sqrt(lV) + powf(inputpop, 2.0e-1f);";
+
+    const std::string declarations = hoistInvariantExpressions(code, {"DT", "inputpop"}, "_h");
+    ASSERT_EQ(code, "lV += _h0 * lI + _h0 + sqrt(lV) + _h1;");
+    ASSERT_EQ(declarations,
+              "const auto _h0 = expf(-DT / 20.0f);\n"
+              "const auto _h1 = powf(inputpop, 2.0e-1f);\n");
+}
+
+TEST(HoistInvariantExpressions, AssignedIdentifiersNotHoisted) {
+    const std::string code = "inputpop += 1.0; lV = sin(inputpop) + cos(t) + std::exp(t) + foo(t);";
+
+    std::string hoistedCode = code;
+    const std::string declarations = hoistInvariantExpressions(hoistedCode, {"t", "inputpop"}, "_h");
+    ASSERT_EQ(hoistedCode, "inputpop += 1.0; lV = sin(inputpop) + _h0 + std::exp(t) + foo(t);");
+    ASSERT_EQ(declarations, "const auto _h0 = cos(t);\n");
+}
+
 //--------------------------------------------------------------------------
 // SingleValueSubstitutionTest
 //--------------------------------------------------------------------------
@@ -0,0 +1,50 @@
+// Standard C++ includes
+#include <vector>
+
+// Standard C includes
+#include <cstdio>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN includes
+#include "connectivityFile.h"
+
+//------------------------------------------------------------------------
+TEST(ConnectivityFile, RoundTrip) {
+    // Row-major 3x4 connectivity with an empty row
+    const std::vector<uint64_t> rowStart{0, 3, 3, 5};
+    const std::vector<uint32_t> ind{0, 2, 3, 1, 2};
+    const std::vector<double> weights{0.5, 1.0, 1.5, 2.0, 2.5};
+    ConnectivityFile::write("roundTrip.conn", 3, 4, rowStart, ind, weights, true);
+
+    ConnectivityFile::Reader reader("roundTrip.conn");
+    ASSERT_EQ(reader.getHeader().numSynapses, 5);
+    ASSERT_EQ(reader.getHeader().maxRowLength, 3);
+    ASSERT_EQ(reader.getHeader().maxColLength, 2);
+    ASSERT_TRUE(reader.hasWeights());
+
+    std::vector<uint64_t> readRowStart(4);
+    std::vector<uint32_t> readInd(5);
+    reader.read(readRowStart.data(), 4);
+    reader.read(readInd.data(), 5);
+    ASSERT_EQ(readRowStart, rowStart);
+    ASSERT_EQ(readInd, ind);
+
+    // Weights should be converted to the type they are read into
+    std::vector<float> readWeights(5);
+    reader.readWeights(readWeights.data(), 5);
+    for(size_t s = 0; s < 5; s++) {
+        ASSERT_FLOAT_EQ(readWeights[s], (float)weights[s]);
+    }
+
+    // Columns should list synapses in order of presynaptic neuron
+    std::vector<uint64_t> colStart(5);
+    std::vector<uint64_t> colSyn(5);
+    reader.read(colStart.data(), 5);
+    reader.read(colSyn.data(), 5);
+    ASSERT_EQ(colStart, std::vector<uint64_t>({0, 1, 2, 4, 5}));
+    ASSERT_EQ(colSyn, std::vector<uint64_t>({0, 3, 1, 4, 2}));
+
+    remove("roundTrip.conn");
+}
@@ -0,0 +1,65 @@
+// C standard includes
+#include <cstdint>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN includes
+#include "fixedPoint.h"
+
+typedef FixedPoint<16> Q16;
+
+//------------------------------------------------------------------------
+TEST(FixedPoint, ConversionRoundsToNearest) {
+    ASSERT_EQ(Q16(1).getRaw(), 65536);
+    ASSERT_EQ(Q16(0.1).getRaw(), 6554);
+    ASSERT_EQ(Q16(-0.1).getRaw(), -6554);
+    ASSERT_EQ(Q16(0.5f).getRaw(), 32768);
+    ASSERT_DOUBLE_EQ((double)Q16(-2.25), -2.25);
+}
+
+TEST(FixedPoint, ConversionSaturates) {
+    ASSERT_EQ(Q16(1.0e6).getRaw(), INT32_MAX);
+    ASSERT_EQ(Q16(-1.0e6).getRaw(), INT32_MIN);
+    ASSERT_EQ(Q16(40000).getRaw(), INT32_MAX);
+    ASSERT_EQ(Q16(-40000).getRaw(), INT32_MIN);
+    ASSERT_EQ(Q16(4000000000u).getRaw(), INT32_MAX);
+}
+
+TEST(FixedPoint, ArithmeticSaturates) {
+    const Q16 big(30000.0);
+    ASSERT_EQ((big + big).getRaw(), INT32_MAX);
+    ASSERT_EQ((-big - big).getRaw(), INT32_MIN);
+    ASSERT_EQ((big * 2).getRaw(), INT32_MAX);
+    ASSERT_EQ((-Q16::fromRaw(INT32_MIN)).getRaw(), INT32_MAX);
+
+    Q16 acc = big;
+    acc += big;
+    ASSERT_EQ(acc.getRaw(), INT32_MAX);
+}
+
+TEST(FixedPoint, MultiplyTruncatesTowardsNegativeInfinity) {
+    const Q16 lsb = Q16::fromRaw(1);
+    ASSERT_EQ((lsb * 0.5).getRaw(), 0);
+    ASSERT_EQ((-lsb * 0.5).getRaw(), -1);
+    ASSERT_EQ((Q16(1.5) * Q16(-2.0)).getRaw(), Q16(-3.0).getRaw());
+}
+
+TEST(FixedPoint, Divide) {
+    ASSERT_EQ((Q16(1) / 4).getRaw(), 16384);
+    ASSERT_EQ((Q16(-1) / 3).getRaw(), -21845);
+    ASSERT_EQ((Q16(1) / 0).getRaw(), INT32_MAX);
+    ASSERT_EQ((Q16(-1) / 0).getRaw(), INT32_MIN);
+}
+
+TEST(FixedPoint, MathsFunctions) {
+    ASSERT_EQ(fabs(Q16(-1.5)), Q16(1.5));
+    ASSERT_EQ(floor(Q16(-1.5)), Q16(-2));
+    ASSERT_EQ(ceil(Q16(-1.5)), Q16(-1));
+    ASSERT_EQ(trunc(Q16(-1.5)), Q16(-1));
+    ASSERT_EQ(fmin(Q16(2), 3.0), Q16(2));
+    ASSERT_EQ(fmax(Q16(2), 3.0), Q16(3));
+    ASSERT_EQ(exp(Q16(0)), Q16(1));
+    ASSERT_EQ(sqrt(Q16(4)), Q16(2));
+    ASSERT_EQ(exp(Q16(20)).getRaw(), INT32_MAX);
+}
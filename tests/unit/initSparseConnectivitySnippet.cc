@@ -0,0 +1,35 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN includes
+#include "initSparseConnectivitySnippet.h"
+
+//--------------------------------------------------------------------------
+// Tests
+//--------------------------------------------------------------------------
+TEST(InitSparseConnectivitySnippet, FixedNumberPostRowLength) {
+    const auto *snippet = InitSparseConnectivitySnippet::FixedNumberPostWithReplacement::getInstance();
+
+    // Every row has exactly the requested number of synapses so no padding is needed
+    ASSERT_EQ(snippet->getCalcMaxRowLengthFunc()(1000, 1000, {10.0}), 10);
+}
+
+TEST(InitSparseConnectivitySnippet, GridNeighbours2D) {
+    // Neurons with unit spacing within unit distance of a neuron away from the
+    // edges of a 10x10 grid are itself and its four direct neighbours
+    ASSERT_EQ(InitSparseConnectivitySnippet::calcMaxGridNeighbours(100, 10, 10, 1.0, 100, 10, 10, 1.0, 1.0), 5);
+
+    // Within a distance of 1.5 the diagonal neighbours are included
+    ASSERT_EQ(InitSparseConnectivitySnippet::calcMaxGridNeighbours(100, 10, 10, 1.0, 100, 10, 10, 1.0, 1.5), 9);
+
+    // A single neuron in the corner of a finer grid only reaches one quadrant of a disc of radius 2
+    ASSERT_EQ(InitSparseConnectivitySnippet::calcMaxGridNeighbours(1, 1, 1, 1.0, 100, 10, 10, 1.0, 2.0), 6);
+}
+
+TEST(InitSparseConnectivitySnippet, GridNeighbours3D) {
+    // Neurons within unit distance in the middle of a 5x5x5 grid are itself and its six face neighbours
+    ASSERT_EQ(InitSparseConnectivitySnippet::calcMaxGridNeighbours(125, 5, 5, 1.0, 125, 5, 5, 1.0, 1.0), 7);
+
+    // A coarse source grid sees more of a fine target grid
+    ASSERT_EQ(InitSparseConnectivitySnippet::calcMaxGridNeighbours(8, 2, 2, 2.0, 125, 5, 5, 1.0, 1.0), 7);
+}
@@ -1,4 +1,5 @@
 // Standard C++ includes
+#include <algorithm>
 #include <tuple>
 
 // Google test includes
@@ -327,6 +328,126 @@ TEST_P(ConstNeuronSynapseVars, VarLocZeroCopyInitDevice)
     ASSERT_TRUE(getModel().canRunOnCPU());
 }
 
+TEST(SynapseIndex, 64BitRequired)
+{
+    NNmodel model;
+
+    WeightUpdateModels::StaticPulse::VarValues wumVals(0.0);
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 100000, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", 100000, {}, {});
+
+    // 100000 rows padded to 10000 synapses fit within 32-bit indices
+    auto *small = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Small", SynapseMatrixType::RAGGED_INDIVIDUALG, NO_DELAY, "Pre", "Post", {}, wumVals, {}, {});
+    small->setMaxConnections(10000);
+    ASSERT_FALSE(small->isSynapseIndex64BitRequired());
+    ASSERT_EQ(small->getSynapseIndexType(), "unsigned int");
+    ASSERT_EQ(small->getSynapseIndexStride(10000), "10000");
+
+    // 100000 rows padded to 50000 synapses do not
+    auto *large = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Large", SynapseMatrixType::RAGGED_INDIVIDUALG, NO_DELAY, "Pre", "Post", {}, wumVals, {}, {});
+    large->setMaxConnections(50000);
+    ASSERT_TRUE(large->isSynapseIndex64BitRequired());
+    ASSERT_EQ(large->getSynapseIndexType(), "uint64_t");
+    ASSERT_EQ(large->getSynapseIndexStride(50000), "50000ull");
+
+    // Nor does a dense 100000 x 100000 matrix
+    auto *dense = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post", {}, wumVals, {}, {});
+    ASSERT_TRUE(dense->isSynapseIndex64BitRequired());
+}
+
+TEST(PhaseOverlap, BlockedNeuronGroups)
+{
+    NNmodel model;
+    model.setPhaseOverlap(true);
+
+    WeightUpdateModels::StaticPulse::VarValues wumVals(0.0);
+    auto *pre = model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    auto *post = model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", 10, {}, {});
+    auto *other = model.addNeuronPopulation<NeuronModels::SpikeSource>("Other", 10, {}, {});
+
+    auto *delayed = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Delayed", SynapseMatrixType::DENSE_INDIVIDUALG, 2, "Pre", "Post", {}, wumVals, {}, {});
+    auto *undelayed = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Undelayed", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Other", {}, wumVals, {}, {});
+    model.finalize();
+
+    // Only synapse groups with axonal delays are overlapped
+    ASSERT_TRUE(model.isSynapseGroupOverlapped(*delayed));
+    ASSERT_FALSE(model.isSynapseGroupOverlapped(*undelayed));
+    ASSERT_TRUE(model.isPhaseOverlapRequired());
+
+    // Presynaptic population gets a spare delay slot so it doesn't need to wait for the overlapped synapse group
+    ASSERT_EQ(pre->getNumDelaySlots(), 4);
+    ASSERT_FALSE(model.isNeuronGroupOverlapBlocked(*pre));
+
+    // But the postsynaptic population it adds input to does
+    ASSERT_TRUE(model.isNeuronGroupOverlapBlocked(*post));
+    ASSERT_FALSE(model.isNeuronGroupOverlapBlocked(*other));
+}
+
+TEST(SynapseMatrixType, Auto)
+{
+    NNmodel model;
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 1000, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", 1000, {}, {});
+
+    WeightUpdateModels::StaticPulse::VarValues constantVals(0.1);
+    InitVarSnippet::Uniform::ParamValues uniformParams(0.0, 1.0);
+    WeightUpdateModels::StaticPulse::VarValues uniformVals(initVar<InitVarSnippet::Uniform>(uniformParams));
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues sparseParams(0.01);
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues denseParams(0.5);
+
+    // Sparse connectivity with randomly initialised weights
+    auto *sparse = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Sparse", SynapseMatrixType::AUTO, NO_DELAY, "Pre", "Post", {}, uniformVals, {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(sparseParams));
+    ASSERT_EQ(sparse->getMatrixType(), SynapseMatrixType::RAGGED_INDIVIDUALG);
+
+    // Sparse connectivity with constant weights
+    auto *sparseGlobal = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SparseGlobal", SynapseMatrixType::AUTO, NO_DELAY, "Pre", "Post", {}, constantVals, {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(sparseParams));
+    ASSERT_EQ(sparseGlobal->getMatrixType(), SynapseMatrixType::RAGGED_GLOBALG);
+
+    // Denser connectivity with constant weights is smaller as a bitmask
+    auto *denseGlobal = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "DenseGlobal", SynapseMatrixType::AUTO, NO_DELAY, "Pre", "Post", {}, constantVals, {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(denseParams));
+    ASSERT_EQ(denseGlobal->getMatrixType(), SynapseMatrixType::BITMASK_GLOBALG);
+
+    // Constant weights which are modified by the model must be individual
+    WeightUpdateModels::PiecewiseSTDP::ParamValues stdpParams(50.0, 50.0, 50.0, 15.0, 15.0, 1.0, 0.5, 33.33, 10.0, 0.5);
+    WeightUpdateModels::PiecewiseSTDP::VarValues stdpVals(0.0, 0.0);
+    auto *plastic = model.addSynapsePopulation<WeightUpdateModels::PiecewiseSTDP, PostsynapticModels::DeltaCurr>(
+        "Plastic", SynapseMatrixType::AUTO, NO_DELAY, "Pre", "Post", stdpParams, stdpVals, {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(denseParams));
+    ASSERT_EQ(plastic->getMatrixType(), SynapseMatrixType::RAGGED_INDIVIDUALG);
+}
+
+TEST(DynamicParams, DerivedParamDependencies)
+{
+    // Derived parameters whose dependence on the first parameter can't be detected by perturbing it slightly
+    const Snippet::Base::DerivedParamVec derivedParams{
+        {"linear", [](const std::vector<double> &pars, double){ return 2.0 * pars[0]; }},
+        {"threshold", [](const std::vector<double> &pars, double){ return (pars[0] > 10.0) ? 1.0 : 0.0; }},
+        {"clamped", [](const std::vector<double> &pars, double){ return std::max(pars[0], 5.0); }},
+        {"other", [](const std::vector<double> &pars, double dt){ return pars[1] * dt; }}};
+
+    const auto dependencies = Snippet::Base::getDerivedParamDependencies(derivedParams, {1.0, 1.0}, {true, false}, 0.1);
+    ASSERT_EQ(dependencies.size(), 2);
+    ASSERT_EQ(dependencies[0], std::vector<size_t>({0, 1, 2}));
+
+    // Dependencies of constant parameters aren't required
+    ASSERT_TRUE(dependencies[1].empty());
+
+    const auto dynamic = Snippet::Base::getDynamicDerivedParams(dependencies, derivedParams.size());
+    ASSERT_EQ(dynamic, std::vector<bool>({true, true, true, false}));
+}
+
 //--------------------------------------------------------------------------
 // Instatiations
 //--------------------------------------------------------------------------
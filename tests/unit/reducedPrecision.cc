@@ -0,0 +1,85 @@
+// C standard includes
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN includes
+#include "reducedPrecision.h"
+
+typedef ReducedPrecision<HalfFormat, float> Half;
+typedef ReducedPrecision<BFloat16Format, float> BFloat16;
+
+//------------------------------------------------------------------------
+TEST(ReducedPrecision, HalfRoundsToNearestEven) {
+    ASSERT_EQ(Half(1.0f).getBits(), 0x3C00);
+    ASSERT_EQ(Half(-2.0f).getBits(), 0xC000);
+    ASSERT_EQ(Half(0.1f).getBits(), 0x2E66);
+    ASSERT_EQ((float)Half(0.1f), 0.0999755859375f);
+
+    // 2049 lies exactly half way between 2048 and 2050 so rounds to even mantissa
+    ASSERT_EQ((float)Half(2049.0f), 2048.0f);
+    ASSERT_EQ((float)Half(2051.0f), 2052.0f);
+}
+
+TEST(ReducedPrecision, HalfRange) {
+    ASSERT_EQ((float)Half(65504.0f), 65504.0f);
+    ASSERT_EQ(Half(65519.0f).getBits(), 0x7BFF);
+    ASSERT_EQ(Half(65520.0f).getBits(), 0x7C00);
+    ASSERT_EQ(Half(-1.0e10f).getBits(), 0xFC00);
+    ASSERT_TRUE(std::isnan((float)Half(std::numeric_limits<float>::quiet_NaN())));
+}
+
+TEST(ReducedPrecision, HalfSubnormal) {
+    const float smallest = std::ldexp(1.0f, -24);
+    ASSERT_EQ(Half(smallest).getBits(), 0x0001);
+    ASSERT_EQ((float)Half::fromBits(0x0001), smallest);
+    ASSERT_EQ((float)Half::fromBits(0x03FF), std::ldexp(1023.0f, -24));
+    ASSERT_EQ(Half(std::ldexp(1.0f, -14)).getBits(), 0x0400);
+
+    // Half the smallest subnormal is a tie so rounds to zero
+    ASSERT_EQ(Half(std::ldexp(1.0f, -25)).getBits(), 0x0000);
+    ASSERT_EQ(Half(-std::ldexp(1.5f, -25)).getBits(), 0x8001);
+}
+
+TEST(ReducedPrecision, BFloat16RoundsToNearestEven) {
+    ASSERT_EQ(BFloat16(1.0f).getBits(), 0x3F80);
+    ASSERT_EQ((float)BFloat16(-3.5f), -3.5f);
+    ASSERT_EQ((float)BFloat16(257.0f), 256.0f);
+    ASSERT_EQ((float)BFloat16(259.0f), 260.0f);
+    ASSERT_EQ(BFloat16(std::numeric_limits<float>::max()).getBits(), 0x7F80);
+    ASSERT_TRUE(std::isnan((float)BFloat16(std::numeric_limits<float>::quiet_NaN())));
+}
+
+TEST(ReducedPrecision, CompoundAssignment) {
+    BFloat16 b(250.0f);
+    for(unsigned int i = 0; i < 10; i++) {
+        b += 1.0;
+    }
+    ASSERT_EQ((float)b, 256.0f);
+
+    Half h(3.0f);
+    h *= 0.5f;
+    h -= 0.25;
+    ASSERT_EQ((float)h, 1.25f);
+}
+
+//------------------------------------------------------------------------
+const float codebookValues[4] = {-1.0f, 0.0f, 0.5f, 2.0f};
+typedef Codebook<float, codebookValues, 4> TestCodebook;
+
+TEST(ReducedPrecision, CodebookNearest) {
+    ASSERT_EQ(sizeof(TestCodebook), 1);
+    ASSERT_EQ(TestCodebook(-5.0f).getIndex(), 0);
+    ASSERT_EQ(TestCodebook(0.0f).getIndex(), 1);
+    ASSERT_EQ(TestCodebook(0.2f).getIndex(), 1);
+    ASSERT_EQ(TestCodebook(0.3f).getIndex(), 2);
+    ASSERT_EQ(TestCodebook(1.3f).getIndex(), 3);
+    ASSERT_EQ(TestCodebook(100.0).getIndex(), 3);
+
+    // Ties are resolved towards the lower value
+    ASSERT_EQ(TestCodebook(0.25f).getIndex(), 1);
+    ASSERT_EQ((float)TestCodebook::fromIndex(2), 0.5f);
+}
@@ -87,4 +87,135 @@ TEST(CreatePostToPreArrayTest, FixedProbability) {
     delete [] projection.revIndInG;
     delete [] projection.ind;
     delete [] projection.indInG;
-}
\ No newline at end of file
+}
+//------------------------------------------------------------------------
+namespace
+{
+// Dense weight of synapse from pre to post - zero if there is no synapse
+float getDenseWeight(unsigned int pre, unsigned int post)
+{
+    return ((pre * 7 + post * 3) % 5 == 0) ? ((post % 2) ? -(float)(pre + 1) : (float)(post + 1)) : 0.0f;
+}
+}
+
+TEST(CreateSparseConnectivityFromDenseRowsTest, MatchesDense) {
+    const unsigned int numPre = 1000;
+    const unsigned int numPost = 200;
+
+    auto getRow = [](unsigned int pre, float *row)
+    {
+        for(unsigned int post = 0; post < numPost; post++) {
+            row[post] = getDenseWeight(pre, post);
+        }
+    };
+
+    // Allocate projection when the number of synapses is known
+    SparseProjection projection;
+    std::vector<unsigned int> ind;
+    std::vector<float> g;
+    float *gPtr = nullptr;
+    projection.indInG = new unsigned int[numPre + 1];
+    auto allocate = [&projection, &ind, &g, &gPtr](unsigned int connN)
+    {
+        projection.connN = connN;
+        ind.resize(connN);
+        g.resize(connN);
+        projection.ind = ind.data();
+        gPtr = g.data();
+    };
+    createSparseConnectivityFromDenseRows<float>(numPre, numPost, getRow, allocate, &gPtr, &projection, 4);
+
+    // Check every non-zero dense entry, including negative ones, is present and in order
+    unsigned int s = 0;
+    for(unsigned int i = 0; i < numPre; i++) {
+        ASSERT_EQ(projection.indInG[i], s);
+        for(unsigned int j = 0; j < numPost; j++) {
+            if(getDenseWeight(i, j) != 0.0f) {
+                ASSERT_EQ(projection.ind[s], j);
+                ASSERT_EQ(g[s], getDenseWeight(i, j));
+                s++;
+            }
+        }
+    }
+    ASSERT_EQ(projection.indInG[numPre], s);
+    ASSERT_EQ(projection.connN, s);
+
+    delete [] projection.indInG;
+}
+
+TEST(CreateRaggedConnectivityFromDenseRowsTest, MatchesDenseFile) {
+    const unsigned int numPre = 1000;
+    const unsigned int numPost = 200;
+
+    // Write dense matrix to file
+    std::vector<float> dense(numPre * numPost);
+    for(unsigned int i = 0; i < numPre; i++) {
+        for(unsigned int j = 0; j < numPost; j++) {
+            dense[(i * numPost) + j] = getDenseWeight(i, j);
+        }
+    }
+    FILE *file = fopen("dense.bin", "wb");
+    fwrite(dense.data(), sizeof(float), dense.size(), file);
+    fclose(file);
+
+    const unsigned int maxRowLength = 40;
+    RaggedProjection<unsigned int> projection(maxRowLength, numPre);
+    std::vector<unsigned int> rowLength(numPre);
+    std::vector<unsigned int> ind(numPre * maxRowLength);
+    std::vector<float> g(numPre * maxRowLength);
+    projection.rowLength = rowLength.data();
+    projection.ind = ind.data();
+    createRaggedConnectivityFromDenseRows(numPre, numPost, denseRowsFromFile<float>("dense.bin", numPost), g.data(), &projection, 4);
+    remove("dense.bin");
+
+    for(unsigned int i = 0; i < numPre; i++) {
+        unsigned int s = 0;
+        for(unsigned int j = 0; j < numPost; j++) {
+            if(getDenseWeight(i, j) != 0.0f) {
+                ASSERT_EQ(ind[(i * maxRowLength) + s], j);
+                ASSERT_EQ(g[(i * maxRowLength) + s], getDenseWeight(i, j));
+                s++;
+            }
+        }
+        ASSERT_EQ(rowLength[i], s);
+    }
+}
+
+//------------------------------------------------------------------------
+TEST(CreateDeltaIndicesTest, RoundTrip) {
+    const unsigned int numPre = 4;
+    const unsigned int maxRowLength = 5;
+
+    // Rows with no synapses, a single synapse, gaps needing 3 bits and gaps needing 31 bits (which span words)
+    RaggedProjection<unsigned int> projection(maxRowLength, 1);
+    std::vector<unsigned int> rowLength{0, 1, 5, 3};
+    std::vector<unsigned int> ind{0, 0, 0, 0, 0,
+                                  7, 0, 0, 0, 0,
+                                  2, 3, 10, 15, 17,
+                                  0, 0x40000000, 0x7FFFFFFF, 0, 0};
+    projection.rowLength = rowLength.data();
+    projection.ind = ind.data();
+
+    DeltaProjection delta = {NULL, NULL, NULL, NULL, 0};
+    createDeltaIndices(numPre, &projection, &delta);
+    EXPECT_EQ(delta.rowWidth[1], 0);
+    EXPECT_EQ(delta.rowWidth[2], 3);
+    EXPECT_EQ(delta.rowWidth[3], 31);
+    EXPECT_EQ(delta.numWords, 0 + 1 + 3 + 1);
+
+    // Decode rows in the same way as generated code
+    for(unsigned int i = 0; i < numPre; i++) {
+        const uint32_t *deltaWords = &delta.words[delta.rowStart[i]];
+        const uint64_t deltaMask = (1ull << delta.rowWidth[i]) - 1;
+        unsigned int deltaPost = delta.rowBase[i];
+        for(unsigned int j = 0; j < rowLength[i]; j++) {
+            const uint64_t deltaBit = (uint64_t)j * delta.rowWidth[i];
+            const uint64_t deltaWindow = ((uint64_t)deltaWords[(deltaBit / 32) + 1] << 32) | deltaWords[deltaBit / 32];
+            deltaPost += (unsigned int)((deltaWindow >> (deltaBit & 31)) & deltaMask);
+            EXPECT_EQ(deltaPost, ind[(i * maxRowLength) + j]);
+        }
+    }
+
+    freeDeltaIndices(&delta);
+    EXPECT_EQ(delta.words, nullptr);
+}
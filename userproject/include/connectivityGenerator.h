@@ -0,0 +1,208 @@
+//--------------------------------------------------------------------------
+/*! \file connectivityGenerator.h
+
+\brief Multithreaded generation of random sparse connectivity in the row-major layout used by ConnectivityFile
+*/
+//--------------------------------------------------------------------------
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Standard C includes
+#include <cmath>
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+// ConnectivityGenerator
+//----------------------------------------------------------------------------
+namespace ConnectivityGenerator
+{
+//! Rows are generated in blocks of this many presynaptic neurons, each with its own random number
+//! stream, so the generated connectivity only depends on the seed and not on the number of threads
+const unsigned int rowsPerBlock = 1024;
+
+//! Row-major connectivity, ready to be written with ConnectivityFile::write
+template<typename WeightType>
+struct Connectivity
+{
+    std::vector<uint64_t> rowStart;
+    std::vector<uint32_t> ind;
+    std::vector<WeightType> weights;
+};
+
+//! Function to generate the sorted postsynaptic indices of presynaptic neuron \p i into \p ind using \p rng
+/*! \p scratch is a per-thread vector of numPost flags which must be left cleared */
+typedef std::function<void(unsigned int i, std::mt19937_64 &rng, std::vector<bool> &scratch, std::vector<uint32_t> &ind)> RowFunc;
+
+//! Function to generate a weight using \p rng
+template<typename WeightType>
+using WeightFunc = std::function<WeightType(std::mt19937_64 &rng)>;
+
+//----------------------------------------------------------------------------
+// Row generators
+//----------------------------------------------------------------------------
+//! Connect each pair of neurons with probability \p prob
+/*! Rather than drawing a random number for every pair, the gaps between synapses are drawn from a geometric distribution */
+inline RowFunc fixedProbability(unsigned int numPost, double prob)
+{
+    return [numPost, prob](unsigned int, std::mt19937_64 &rng, std::vector<bool>&, std::vector<uint32_t> &ind)
+    {
+        if(prob >= 1.0) {
+            for(unsigned int j = 0; j < numPost; j++) {
+                ind.push_back(j);
+            }
+        }
+        else if(prob > 0.0) {
+            const double logProb = std::log(1.0 - prob);
+            std::uniform_real_distribution<double> dist(0.0, 1.0);
+            for(uint64_t j = 0;; j++) {
+                j += (uint64_t)std::floor(std::log(1.0 - dist(rng)) / logProb);
+                if(j >= numPost) {
+                    break;
+                }
+                ind.push_back((uint32_t)j);
+            }
+        }
+    };
+}
+
+//! Connect each presynaptic neuron to \p numConnections distinct, randomly chosen, postsynaptic neurons
+/*! Uses Floyd's algorithm so the cost of each row depends on the number of connections rather than numPost */
+inline RowFunc fixedNumberPost(unsigned int numPost, unsigned int numConnections)
+{
+    return [numPost, numConnections](unsigned int, std::mt19937_64 &rng, std::vector<bool> &scratch, std::vector<uint32_t> &ind)
+    {
+        const size_t rowBegin = ind.size();
+        for(unsigned int j = numPost - std::min(numConnections, numPost); j < numPost; j++) {
+            const uint32_t t = std::uniform_int_distribution<uint32_t>(0, j)(rng);
+            const uint32_t selected = scratch[t] ? j : t;
+            scratch[selected] = true;
+            ind.push_back(selected);
+        }
+
+        // Sort row and clear flags for the next row
+        std::sort(ind.begin() + rowBegin, ind.end());
+        for(size_t s = rowBegin; s < ind.size(); s++) {
+            scratch[ind[s]] = false;
+        }
+    };
+}
+
+//----------------------------------------------------------------------------
+// Weight generators
+//----------------------------------------------------------------------------
+template<typename WeightType>
+WeightFunc<WeightType> constantWeight(WeightType value)
+{
+    return [value](std::mt19937_64&){ return value; };
+}
+
+template<typename WeightType>
+WeightFunc<WeightType> uniformWeight(WeightType min, WeightType max)
+{
+    return [min, max](std::mt19937_64 &rng){ return std::uniform_real_distribution<WeightType>(min, max)(rng); };
+}
+
+template<typename WeightType>
+WeightFunc<WeightType> normalWeight(WeightType mean, WeightType sd)
+{
+    return [mean, sd](std::mt19937_64 &rng){ return std::normal_distribution<WeightType>(mean, sd)(rng); };
+}
+
+//----------------------------------------------------------------------------
+// Generation
+//----------------------------------------------------------------------------
+//! Calls \p blockFunc for every block of rows, distributing blocks between \p numThreads threads
+inline void parallelForBlocks(unsigned int numPre, unsigned int numThreads, std::function<void(unsigned int block)> blockFunc)
+{
+    const unsigned int numBlocks = (numPre + rowsPerBlock - 1) / rowsPerBlock;
+    std::atomic<unsigned int> nextBlock(0);
+    auto worker = [numBlocks, &nextBlock, &blockFunc]()
+    {
+        for(unsigned int b = nextBlock++; b < numBlocks; b = nextBlock++) {
+            blockFunc(b);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(unsigned int t = 1; t < std::min(numThreads, numBlocks); t++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for(auto &t : threads) {
+        t.join();
+    }
+}
+
+//! Generates connectivity between \p numPre and \p numPost neurons using \p numThreads threads
+/*! Rows are generated twice with identical random number streams - firstly to count synapses and secondly to
+    write them directly into place - so no more memory than the final connectivity is required.
+    If \p weightFunc is empty, no weights are generated */
+template<typename WeightType>
+Connectivity<WeightType> generate(unsigned int numPre, unsigned int numPost, uint64_t seed, unsigned int numThreads,
+                                  RowFunc rowFunc, WeightFunc<WeightType> weightFunc = WeightFunc<WeightType>())
+{
+    auto createRNG = [seed](unsigned int block)
+    {
+        std::seed_seq seedSeq{(uint32_t)seed, (uint32_t)(seed >> 32), block};
+        return std::mt19937_64(seedSeq);
+    };
+
+    // Count synapses in each row
+    Connectivity<WeightType> connectivity;
+    connectivity.rowStart.resize(numPre + 1, 0);
+    parallelForBlocks(numPre, numThreads,
+        [numPre, numPost, &createRNG, &rowFunc, &connectivity](unsigned int block)
+        {
+            std::mt19937_64 rng = createRNG(block);
+            std::vector<bool> scratch(numPost, false);
+            std::vector<uint32_t> ind;
+            const unsigned int blockEnd = std::min(numPre, (block + 1) * rowsPerBlock);
+            for(unsigned int i = block * rowsPerBlock; i < blockEnd; i++) {
+                ind.clear();
+                rowFunc(i, rng, scratch, ind);
+                connectivity.rowStart[i + 1] = ind.size();
+            }
+        });
+
+    // Convert row lengths into start indices
+    for(unsigned int i = 0; i < numPre; i++) {
+        connectivity.rowStart[i + 1] += connectivity.rowStart[i];
+    }
+
+    // Regenerate rows, writing them and their weights directly into place
+    connectivity.ind.resize(connectivity.rowStart.back());
+    if(weightFunc) {
+        connectivity.weights.resize(connectivity.rowStart.back());
+    }
+    parallelForBlocks(numPre, numThreads,
+        [numPre, numPost, &createRNG, &rowFunc, &weightFunc, &connectivity](unsigned int block)
+        {
+            std::mt19937_64 rng = createRNG(block);
+            std::vector<bool> scratch(numPost, false);
+            std::vector<uint32_t> ind;
+            const unsigned int blockEnd = std::min(numPre, (block + 1) * rowsPerBlock);
+            for(unsigned int i = block * rowsPerBlock; i < blockEnd; i++) {
+                ind.clear();
+                rowFunc(i, rng, scratch, ind);
+                std::copy(ind.cbegin(), ind.cend(), connectivity.ind.begin() + connectivity.rowStart[i]);
+            }
+
+            // Weights are drawn after all of the block's rows so they don't change the connectivity
+            if(weightFunc) {
+                const uint64_t synBegin = connectivity.rowStart[block * rowsPerBlock];
+                const uint64_t synEnd = connectivity.rowStart[blockEnd];
+                std::generate(connectivity.weights.begin() + synBegin, connectivity.weights.begin() + synEnd,
+                              [&weightFunc, &rng](){ return weightFunc(rng); });
+            }
+        });
+
+    return connectivity;
+}
+}   // namespace ConnectivityGenerator
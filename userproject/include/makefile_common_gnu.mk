@@ -56,8 +56,8 @@ ifeq ($(DARWIN),DARWIN)
     CXX                 :=clang++
 endif
 
-# C++ flags should always include C++ standard and build dependency
-CXXFLAGS                +=-std=$(CPP_STANDARD) -MMD -MP
+# C++ flags should always include C++ standard, pthreads (the generated runner may use std::thread) and build dependency
+CXXFLAGS                +=-std=$(CPP_STANDARD) -pthread -MMD -MP
 
 ifdef CPU_ONLY
     LIBGENN_PREFIX      :=$(LIBGENN_PREFIX)_CPU_ONLY
@@ -80,6 +80,17 @@ ifdef COVERAGE
     CXXFLAGS            +=-O0 --coverage
 endif
 
+# Build optimisation modes - these are also passed to the Makefile for the generated code
+ifeq ($(NATIVE),1)
+    CXXFLAGS            +=-march=native
+endif
+ifeq ($(LTO),1)
+    CXXFLAGS            +=-flto
+endif
+ifeq ($(PGO),generate)
+    LINK_FLAGS          +=-fprofile-generate
+endif
+
 # Global include and link flags
 ifndef CPU_ONLY
     INCLUDE_FLAGS       +=-I"$(GENN_PATH)/lib/include" -I"$(GENN_PATH)/userproject/include" -I"$(CUDA_PATH)/include"
@@ -0,0 +1,147 @@
+//--------------------------------------------------------------------------
+/*! \file gen_syns_parallel.cc
+
+\brief This file generates random sparse connectivity using multiple threads and saves it, together with its weights, to a single connectivity file.
+
+The file can be loaded into a SPARSE or RAGGED synapse population using the generated load<synapse population>Connectivity() function.
+*/
+//--------------------------------------------------------------------------
+//./gen_syns_parallel 10000 10000 1000 syns.conn FIXED_NUMBER=1 WEIGHT=UNIFORM W0=0.0 W1=0.5
+
+// Standard C++ includes
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+// Standard C includes
+#include <cstdlib>
+
+// GeNN includes
+#include "connectivityFile.h"
+
+// Userproject includes
+#include "command_line_processing.h"
+#include "connectivityGenerator.h"
+
+template<typename WeightType>
+void generateAndWrite(unsigned int numPre, unsigned int numPost, double connectivityParam, bool fixedNumber,
+                      const string &weightDist, double w0, double w1, uint64_t seed, unsigned int numThreads,
+                      bool reverse, const string &filename)
+{
+    using namespace ConnectivityGenerator;
+
+    // Create function to generate rows
+    const RowFunc rowFunc = fixedNumber ? fixedNumberPost(numPost, (unsigned int)connectivityParam)
+        : fixedProbability(numPost, connectivityParam);
+
+    // Create function to generate weights
+    WeightFunc<WeightType> weightFunc;
+    if (weightDist == "CONSTANT") {
+        weightFunc = constantWeight<WeightType>(w0);
+    }
+    else if (weightDist == "UNIFORM") {
+        weightFunc = uniformWeight<WeightType>(w0, w1);
+    }
+    else if (weightDist == "NORMAL") {
+        weightFunc = normalWeight<WeightType>(w0, w1);
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+    const Connectivity<WeightType> connectivity = generate(numPre, numPost, seed, numThreads, rowFunc, weightFunc);
+    const auto generatedTime = std::chrono::steady_clock::now();
+
+    ConnectivityFile::write(filename, numPre, numPost, connectivity.rowStart, connectivity.ind, connectivity.weights, reverse);
+    const auto writtenTime = std::chrono::steady_clock::now();
+
+    cout << connectivity.ind.size() << " synapses generated in " << std::chrono::duration<double>(generatedTime - startTime).count();
+    cout << "s using " << numThreads << " threads and written in " << std::chrono::duration<double>(writtenTime - generatedTime).count() << "s" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 5)
+    {
+        cerr << "usage: gen_syns_parallel <nPre> <nPost> <prob. of connection or number of connections per presynaptic neuron> <outfile>";
+        cerr << " [FIXED_NUMBER=0/1] [WEIGHT=NONE/CONSTANT/UNIFORM/NORMAL] [W0=constant, minimum or mean weight] [W1=maximum weight or standard deviation]";
+        cerr << " [FTYPE=FLOAT/DOUBLE] [SEED=seed] [THREADS=number of threads] [REVERSE=0/1]" << endl;
+        exit(1);
+    }
+
+    const unsigned int numPre = atoi(argv[1]);
+    const unsigned int numPost = atoi(argv[2]);
+    const double connectivityParam = atof(argv[3]);
+    const string filename = argv[4];
+
+    // parse options
+    unsigned int fixedNumber = 0;
+    string weightDist = "CONSTANT";
+    double w0 = 1.0;
+    double w1 = 0.0;
+    string ftype = "FLOAT";
+    uint64_t seed = 1234;
+    unsigned int numThreads = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int reverse = 0;
+    string option;
+    for (int i = 5; i < argc; i++) {
+        string value;
+        if (extract_option(argv[i], option) != 0 || extract_string_value(argv[i], value) != 0) {
+            cerr << "Unknown option '" << argv[i] << "'." << endl;
+            exit(1);
+        }
+        else if (option == "FIXED_NUMBER") {
+            if (extract_bool_value(argv[i], fixedNumber) != 0) {
+                cerr << "illegal value for 'FIXED_NUMBER' option." << endl;
+                exit(1);
+            }
+        }
+        else if (option == "WEIGHT") {
+            weightDist = toUpper(value);
+            if ((weightDist != "NONE") && (weightDist != "CONSTANT") && (weightDist != "UNIFORM") && (weightDist != "NORMAL")) {
+                cerr << "illegal value " << weightDist << " of 'WEIGHT' option." << endl;
+                exit(1);
+            }
+        }
+        else if (option == "W0") {
+            w0 = atof(value.c_str());
+        }
+        else if (option == "W1") {
+            w1 = atof(value.c_str());
+        }
+        else if (option == "FTYPE") {
+            ftype = toUpper(value);
+            if ((ftype != "FLOAT") && (ftype != "DOUBLE")) {
+                cerr << "illegal value " << ftype << " of 'FTYPE' option." << endl;
+                exit(1);
+            }
+        }
+        else if (option == "SEED") {
+            seed = strtoull(value.c_str(), NULL, 10);
+        }
+        else if (option == "THREADS") {
+            numThreads = std::max(1, atoi(value.c_str()));
+        }
+        else if (option == "REVERSE") {
+            if (extract_bool_value(argv[i], reverse) != 0) {
+                cerr << "illegal value for 'REVERSE' option." << endl;
+                exit(1);
+            }
+        }
+        else {
+            cerr << "Unknown option '" << argv[i] << "'." << endl;
+            exit(1);
+        }
+    }
+
+    cerr << "# call was: ";
+    for (int i = 0; i < argc; i++) cerr << argv[i] << " ";
+    cerr << endl;
+
+    if (ftype == "FLOAT") {
+        generateAndWrite<float>(numPre, numPost, connectivityParam, fixedNumber, weightDist, w0, w1, seed, numThreads, reverse, filename);
+    }
+    else {
+        generateAndWrite<double>(numPre, numPost, connectivityParam, fixedNumber, weightDist, w0, w1, seed, numThreads, reverse, filename);
+    }
+    return 0;
+}